@@ -0,0 +1,72 @@
+#ifndef AABB_SIMD_H
+#define AABB_SIMD_H
+
+#include "fixed_point.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file aabb_simd.h
+ * @brief Tests one AABB against many boxes at once (SSE2 / AVX2 / AVX-512).
+ *
+ * The boxes tested share one size (enemies, bunkers, bullets) and are
+ * given as two arrays of coordinates, so a kernel loads 4, 8 or 16 of them
+ * per instruction. The test is checkOverlap()'s, lane by lane, on 32-bit
+ * integers (fixed_point.h): every kernel returns exactly the same mask.
+ * Since overlap is symmetric, the same call also tests a batch of bullets
+ * against one box.
+ *
+ * The fastest kernel the CPU supports (cpuid) is selected when the program
+ * starts; setAabbKernel() overrides it (benchmarks, differential checks).
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Largest number of boxes tested by one call (bits of the mask). */
+#define AABB_BATCH_MAX 32
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief Instruction sets a kernel may use. */
+typedef enum {
+  AABB_KERNEL_SCALAR,
+  AABB_KERNEL_SSE2,
+  AABB_KERNEL_AVX2,
+  AABB_KERNEL_AVX512,
+  AABB_KERNEL_COUNT
+} AabbKernel;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Tests the box (x, y, w, h) against `count` boxes of size (bw, bh).
+ * @param bx    Left edges of the boxes.
+ * @param by    Top edges of the boxes.
+ * @param count Number of boxes (<= AABB_BATCH_MAX).
+ * @return uint32_t Bit `i` is set if box `i` overlaps (x, y, w, h).
+ */
+uint32_t overlapBoxes(Fixed x, Fixed y, Fixed w, Fixed h, const Fixed *bx,
+                      const Fixed *by, Fixed bw, Fixed bh, int count);
+
+/** @brief Tells whether the CPU (and OS) can run a kernel. */
+bool isAabbKernelSupported(AabbKernel kernel);
+
+/** @brief Kernel used by overlapBoxes(). */
+AabbKernel getAabbKernel(void);
+
+/**
+ * @brief Makes overlapBoxes() use a given kernel.
+ * @return false (and nothing changes) if the kernel is not supported.
+ */
+bool setAabbKernel(AabbKernel kernel);
+
+/** @brief Short name of a kernel ("scalar", "sse2", "avx2", "avx512"). */
+const char *getAabbKernelName(AabbKernel kernel);
+
+#endif // AABB_SIMD_H
@@ -1,15 +1,17 @@
 #ifndef BUNKER_H
 #define BUNKER_H
 
-#include "projectile.h"
+#include "fixed_point.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * @file bunker.h
  * @brief Manages the destructible shields (bunkers) protecting the player.
  * * This module handles the creation, rendering, and collision detection
- * for the bunkers. Each bunker is composed of smaller "blocks" that can
- * be individually destroyed by projectiles from either the player or enemies.
+ * for the bunkers. A bunker starts as the classic shape made of blocks, but
+ * it is stored (and eroded) pixel by pixel: every projectile that hits it
+ * blasts a small crater out of its bitmap, like in the arcade original.
  */
 
 // ==========================================
@@ -23,49 +25,60 @@
 #define BUNKER_COUNT 4
 
 /**
- * @brief The number of rows of blocks in a single bunker.
+ * @brief The number of rows of blocks in a single bunker (initial shape).
  */
 #define BUNKER_ROWS 8
 
 /**
- * @brief The number of columns of blocks in a single bunker.
+ * @brief The number of columns of blocks in a single bunker (initial shape).
  */
 #define BUNKER_COLS 10
 
-/**
- * @brief The width and height of a single bunker block in pixels.
- * Used for rendering and collision bounding boxes.
- */
-#define BLOCK_SIZE 8.0f
+/** @brief Side of a block of the initial shape, in whole pixels. */
+#define BLOCK_PIXELS 8
+
+/** @brief Size of the damage bitmap of one bunker, in pixels. */
+#define BUNKER_PIXEL_WIDTH (BUNKER_COLS * BLOCK_PIXELS)
+#define BUNKER_PIXEL_HEIGHT (BUNKER_ROWS * BLOCK_PIXELS)
+
+/** @brief Pixels per BunkerRow word. */
+#define BUNKER_WORD_BITS 16
+
+/** @brief BunkerRow words per row of pixels. */
+#define BUNKER_ROW_WORDS                                                       \
+  ((BUNKER_PIXEL_WIDTH + BUNKER_WORD_BITS - 1) / BUNKER_WORD_BITS)
+
+/** @brief Side of the crater blasted by a projectile, in pixels. */
+#define BUNKER_CRATER_SIZE 8
 
 // ==========================================
 //               STRUCTURES
 // ==========================================
 
 /**
- * @brief Represents a single destructible piece of a bunker.
- * * A bunker is made of many of these blocks. When a projectile hits a block,
- * that specific block is deactivated (destroyed), eroding the bunker.
+ * @brief 16 pixels of a row of a bunker bitmap: bit `i` of word `w` is
+ * pixel `w * BUNKER_WORD_BITS + i`, set while that pixel is intact.
  */
-typedef struct {
-  float x;     /**< Absolute X position on the screen. */
-  float y;     /**< Absolute Y position on the screen. */
-  bool active; /**< True if the block exists; False if it has been destroyed. */
-} BunkerBlock;
+typedef uint16_t BunkerRow;
 
 /**
  * @brief Represents a single Bunker entity.
- * * A bunker acts as a shield. It is defined by a top-left position and
- * an array of blocks that constitute its shape.
+ * * A bunker acts as a shield. It is defined by a top-left position and a
+ * damage bitmap: pixel (px, py) covers the unit square at (x + px, y + py).
  */
 typedef struct {
-  float x; /**< The top-left X coordinate of the entire bunker structure. */
-  float y; /**< The top-left Y coordinate of the entire bunker structure. */
+  Fixed x; /**< The top-left X coordinate of the entire bunker structure. */
+  Fixed y; /**< The top-left Y coordinate of the entire bunker structure. */
+
+  /** @brief Intact pixels, BUNKER_ROW_WORDS words per row. */
+  BunkerRow pixels[BUNKER_PIXEL_HEIGHT][BUNKER_ROW_WORDS];
 
-  /** * @brief Flattened array of blocks representing the bunker's grid.
-   * Access logic usually maps (row, col) to index [row * COLS + col].
+  /**
+   * @brief hashBunkerPixels() of the bitmap, kept up to date as pixels
+   * are blasted (one XOR per erased pixel), so that hashing a World never
+   * reads the bitmaps.
    */
-  BunkerBlock blocks[BUNKER_ROWS * BUNKER_COLS];
+  uint64_t hash;
 } Bunker;
 
 /**
@@ -96,22 +109,32 @@ BunkerManager *createBunkers(unsigned screenWidth);
 void destroyBunkers(BunkerManager *bm);
 
 /**
- * @brief Checks for collisions between a projectile and any active bunker
- * block.
- * * If a collision is detected:
- * 1. The specific `BunkerBlock` hit is set to inactive (destroyed).
- * 2. The function returns true, indicating the projectile should also be
- * destroyed.
- * * @param bm Pointer to the BunkerManager.
- * @param p  Pointer to the projectile to check.
- * @return true  If the projectile hit a bunker block.
- * @return false If no collision occurred.
+ * @brief Checks a moving box against the intact pixels of the bunkers: the
+ * first intact pixel met by a box (w, h) moving from (x0, y0) to (x1, y1).
+ * A vertical path meets the rows in order, so the leading intact row of the
+ * swept area is the impact; other paths are walked in sub-steps of at most
+ * one pixel. Either way, the rows under the box are tested from its
+ * leading edge (the bottom one if `up` is false).
+ * @param bm  The bunkers.
+ * @param up  The box moves up.
+ * @param toi [Output] Fraction of the path flown before the impact.
+ * @param cx  [Output] Crater centre column, in bunker pixels.
+ * @param cy  [Output] Impact row, in bunker pixels.
+ * @return int Index of the bunker hit first (lowest on a tie), or -1.
+ */
+int sweepBunkers(const BunkerManager *bm, Fixed x0, Fixed y0, Fixed x1,
+                 Fixed y1, Fixed w, Fixed h, bool up, Fixed *toi, int *cx,
+                 int *cy);
+
+/**
+ * @brief Clears the crater (BUNKER_CRATER_SIZE pixels wide) centred on
+ * pixel (cx, cy) of a bunker.
  */
-bool checkBunkerCollision(BunkerManager *bm, Projectile *p);
+void blastBunkerCrater(Bunker *b, int cx, int cy);
 
 /**
  * @brief Restores all bunkers to their pristine state.
- * * Reactivates all blocks in every bunker. Used when restarting the game
+ * * Restores the intact bitmap of every bunker. Used when restarting the game
  * or potentially when advancing to a new level (if game design dictates).
  * * @param bm          Pointer to the BunkerManager.
  * @param screenWidth The logical width of the screen (to recalculate positions
@@ -119,4 +142,25 @@ bool checkBunkerCollision(BunkerManager *bm, Projectile *p);
  */
 void resetBunkers(BunkerManager *bm, unsigned screenWidth);
 
+/**
+ * @brief Tells whether pixel (px, py) of a bunker is intact.
+ * @param b  The bunker.
+ * @param px Column in [0, BUNKER_PIXEL_WIDTH).
+ * @param py Row in [0, BUNKER_PIXEL_HEIGHT).
+ */
+bool isBunkerPixelSet(const Bunker *b, int px, int py);
+
+/**
+ * @brief Hashes the intact pixels of a bunker from scratch: the XOR of a
+ * random 64-bit key per intact pixel (Zobrist hashing). Erasing a pixel
+ * XORs its key out, which is how Bunker.hash follows the bitmap.
+ */
+uint64_t hashBunkerPixels(const Bunker *b);
+
+/**
+ * @brief Counts the intact pixels of the rectangle [x0, x1) x [y0, y1) of
+ * a bunker (one popcount per word). The rectangle is clamped to the bitmap.
+ */
+int countBunkerPixels(const Bunker *b, int x0, int y0, int x1, int y1);
+
 #endif // BUNKER_H
\ No newline at end of file
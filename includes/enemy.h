@@ -1,8 +1,12 @@
 #ifndef ENEMY_H
 #define ENEMY_H
 
+#include "fixed_point.h"
 #include "projectile.h"
+#include "rng.h"
+#include "timer_wheel.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * @file enemy.h
@@ -12,8 +16,14 @@
  * - Classic movement pattern (Step Right -> Hit Edge -> Drop Down -> Step
  * Left).
  * - Speed increases as fewer enemies remain.
- * - Random enemy shooting.
+ * - Random enemy shooting (driven by the Swarm's own seeded Rng stream).
  * - Boss encounters at specific levels.
+ *
+ * What a level does is picked once, when it starts: initSwarm() looks the
+ * level up in a table of SwarmKind, and every later call (update, shoot,
+ * "is it cleared?") goes through that kind's SwarmBehavior instead of
+ * testing the level number. Physics and the views keep their own tables
+ * indexed by SwarmKind, for what they do with each kind.
  */
 
 // ==========================================
@@ -35,9 +45,24 @@
 /** @brief Height of a single standard enemy in pixels. */
 #define ENEMY_HEIGHT 30
 
+/** @brief Size of the Level 2 boss in pixels. */
+#define BOSS_WIDTH 64
+#define BOSS_HEIGHT 64
+
+/** @brief Horizontal speed of the boss in pixels per second (Fixed). */
+#define BOSS_SPEED FIXED(150)
+
 /** @brief Horizontal/Vertical gap between enemies in the grid. */
 #define ENEMY_PADDING 10
 
+/**
+ * @brief Distance between two neighbouring columns / rows of the grid.
+ * The whole swarm moves in lockstep, so enemy (row, col) always sits at
+ * the swarm origin + (col * ENEMY_PITCH_X, row * ENEMY_PITCH_Y).
+ */
+#define ENEMY_PITCH_X (ENEMY_WIDTH + ENEMY_PADDING)
+#define ENEMY_PITCH_Y (ENEMY_HEIGHT + ENEMY_PADDING)
+
 /** @brief Starting X position for the top-left enemy. */
 #define ENEMY_START_X 50
 
@@ -47,15 +72,25 @@
 /** @brief Score awarded to the player for destroying one enemy. */
 #define ENEMY_KILL_SCORE 100
 
+/** @brief Seed used by createSwarm() until seedSwarm() is called. */
+#define SWARM_DEFAULT_SEED 0x5EED5EEDULL
+
+/**
+ * @brief Number of levels (entries of the level table in enemy.c). A new
+ * level is one more entry, with an existing or a new SwarmKind. Clearing
+ * level LEVEL_COUNT wins the game.
+ */
+#define LEVEL_COUNT 2
+
 // ==========================================
 //            MOVEMENT & DIFFICULTY
 // ==========================================
 
-/** @brief Horizontal pixels moved per "tick" (step). */
-#define ENEMY_STEP_X 10.0f
+/** @brief Horizontal pixels moved per "tick" (step, Fixed). */
+#define ENEMY_STEP_X FIXED(10)
 
 /** @brief Vertical pixels dropped when the swarm hits the screen edge. */
-#define ENEMY_DROP_AMOUNT 20.0f
+#define ENEMY_DROP_AMOUNT FIXED(20)
 
 // --- Speed Scaling (Difficulty) ---
 /** @brief Maximum time between steps (Start of game, full swarm). Slowest. */
@@ -74,32 +109,52 @@
 //               STRUCTURES
 // ==========================================
 
+/** @brief What a level is made of (index of the behaviour tables). */
+typedef enum {
+  SWARM_GRID, /**< The classic grid of aliens, moving in steps. */
+  SWARM_BOSS, /**< A single Boss, moving continuously. */
+  SWARM_KIND_COUNT
+} SwarmKind;
+
 /**
  * @brief Represents a single standard Alien Invader.
+ * Its position is not stored: the grid moves as one block, so it is derived
+ * from the Swarm origin and the slot (getEnemyX() / getEnemyY()).
  */
 typedef struct {
-  float x;            /**< Current X position. */
-  float y;            /**< Current Y position. */
   unsigned width;     /**< Width for collision detection. */
   unsigned height;    /**< Height for collision detection. */
   unsigned killScore; /**< Score value of this specific unit. */
   bool active;        /**< true if alive, false if destroyed. */
 } Enemy;
 
+/**
+ * @brief Bitmask view of the living grid enemies.
+ * Every kill clears one bit in each array (killSwarmEnemy()), so the alive
+ * count, the true edges of the swarm and the bottom-most enemy of a column
+ * are read with a few bit instructions instead of a scan of the grid.
+ */
+typedef struct {
+  uint16_t rows[ENEMY_ROWS]; /**< Bit `col` set if (row, col) is alive. */
+  uint8_t cols[ENEMY_COLS];  /**< Bit `row` set if (row, col) is alive. */
+} SwarmAlive;
+
+_Static_assert(ENEMY_COLS <= 16 && ENEMY_ROWS <= 8,
+               "SwarmAlive masks are too narrow for the grid");
+
 /**
  * @brief Represents the Boss enemy (Mother Ship).
  * Appears in specific levels (e.g., Level 2). moves independently.
  */
 typedef struct {
-  bool active;     /**< true if the boss is currently fighting. */
-  float x;         /**< Current X position. */
-  float y;         /**< Current Y position. */
-  float width;     /**< Boss width. */
-  float height;    /**< Boss height. */
-  int health;      /**< Current HP. */
-  int maxHealth;   /**< Starting HP (for health bar rendering). */
-  float moveTimer; /**< Internal timer for movement updates. */
-  int direction;   /**< 1 for Right, -1 for Left. */
+  bool active;   /**< true if the boss is currently fighting. */
+  Fixed x;       /**< Current X position. */
+  Fixed y;       /**< Current Y position. */
+  Fixed width;   /**< Boss width. */
+  Fixed height;  /**< Boss height. */
+  int health;    /**< Current HP. */
+  int maxHealth; /**< Starting HP (for health bar rendering). */
+  int direction; /**< 1 for Right, -1 for Left. */
 } Boss;
 
 /**
@@ -112,6 +167,20 @@ typedef struct {
   /** @brief Static array of all standard enemies. */
   Enemy enemies[TOTAL_ENEMIES];
 
+  /** @brief Same information as enemies[].active, as bitmasks. */
+  SwarmAlive alive;
+
+  /**
+   * @brief hashSwarmEnemies() of enemies[].active, kept up to date as
+   * enemies are killed (one XOR each), so that hashing a World never walks
+   * enemies[].
+   */
+  uint64_t enemyHash;
+
+  /** @brief Top-left corner of slot 0 (row 0, column 0), dead or alive. */
+  Fixed originX;
+  Fixed originY;
+
   /** @brief The Boss entity associated with this swarm level. */
   Boss boss;
 
@@ -119,39 +188,158 @@ typedef struct {
   int direction;
 
   // --- Movement Timer Logic ---
-  /** @brief Accumulates deltaTime. When > moveInterval, the swarm steps. */
-  float moveTimer;
+  /** @brief Clock time of the last step: the next one is moveInterval later. */
+  TimerTime lastMoveAt;
 
-  /** * @brief Threshold for moveTimer.
+  /** * @brief Time between two steps.
    * Decreases linearly as aliveCount decreases, making the swarm faster.
    */
-  float moveInterval;
+  TimerTime moveInterval;
 
   // --- Shooting Timer Logic ---
-  float shootTimer;    /**< Accumulates deltaTime for shooting. */
-  float shootCooldown; /**< Time required before the next random shot. */
+  TimerTime shootAt;       /**< Clock time of the next random shot. */
+  TimerTime shootCooldown; /**< Time between two random shots. */
 
   unsigned aliveCount; /**< Number of active enemies remaining. */
 
-  int level; /**< Current difficulty/wave level. */
+  int level;      /**< Current difficulty/wave level. */
+  SwarmKind kind; /**< What `level` is made of (set by initSwarm()). */
 
   /** @brief Toggle for animation (arms up / arms down). Flips every step. */
   bool animationFrame;
+
+  /** @brief Private random stream used to pick the shooting column. */
+  Rng rng;
 } Swarm;
 
+/**
+ * @brief What a SwarmKind does. updateSwarm(), enemyAttemptShoot() and
+ * isSwarmDestroyed() call the entry of `swarm->kind`.
+ */
+typedef struct {
+  /** @brief Lays the enemies out (on a zeroed Swarm, timers set). */
+  void (*init)(Swarm *swarm);
+  /** @brief Moves the enemies (see updateSwarm()). */
+  void (*update)(Swarm *swarm, Fixed deltaTime, TimerTime now,
+                 unsigned screenWidth);
+  /** @brief Fires, once the cooldown is over (see enemyAttemptShoot()). */
+  bool (*shoot)(Swarm *swarm, Projectiles *projectiles);
+  /** @brief true once the level is cleared. */
+  bool (*isDestroyed)(const Swarm *swarm);
+} SwarmBehavior;
+
 // ==========================================
 //               FUNCTIONS
 // ==========================================
 
+/**
+ * @brief SwarmKind of `level`. Levels past LEVEL_COUNT replay the last one,
+ * levels below 1 the first one.
+ */
+SwarmKind getLevelKind(int level);
+
+/** @brief The behaviour of `kind` (< SWARM_KIND_COUNT). */
+const SwarmBehavior *getSwarmBehavior(SwarmKind kind);
+
 /**
  * @brief Allocates and initializes the Swarm.
  * Sets up the grid layout, difficulty settings, and optional Boss based on
  * level.
- * @param level Current game level (1 = Standard, 2 = Boss, etc.).
+ * @param level Current game level (1 = Standard, 2 = Boss, see
+ * getLevelKind()).
  * @return Swarm* Pointer to the new Swarm object.
  */
 Swarm *createSwarm(int level);
 
+/**
+ * @brief Initializes an already allocated Swarm (e.g., embedded in a World).
+ * Same layout as createSwarm(), without any allocation. The random stream
+ * is reset to SWARM_DEFAULT_SEED. The swarm fires at once and steps
+ * moveInterval after `now`. Sets `swarm->kind` from the level table.
+ * @param swarm Pointer to the Swarm to (re)initialize.
+ * @param level Current game level (1 = Standard, 2 = Boss, etc.).
+ * @param now   Clock of the World.
+ */
+void initSwarm(Swarm *swarm, int level, TimerTime now);
+
+/**
+ * @brief Restarts the Swarm's random stream from an explicit seed.
+ * Two swarms with the same seed fire the exact same sequence of shots.
+ * @param swarm Pointer to the Swarm.
+ * @param seed  Any 64-bit value.
+ */
+void seedSwarm(Swarm *swarm, uint64_t seed);
+
+/**
+ * @brief Current X of grid slot `index`: origin + column * ENEMY_PITCH_X.
+ * @param swarm Pointer to the Swarm.
+ * @param index Index in enemies[] (row * ENEMY_COLS + col).
+ */
+Fixed getEnemyX(const Swarm *swarm, int index);
+
+/** @brief Current Y of grid slot `index`: origin + row * ENEMY_PITCH_Y. */
+Fixed getEnemyY(const Swarm *swarm, int index);
+
+/**
+ * @brief Recomputes aliveCount from the alive masks, and the step interval
+ * and shooting cooldown that follow from it (getSwarmInterval()).
+ * @param swarm Pointer to the Swarm.
+ */
+void updateSwarmSpeed(Swarm *swarm);
+
+/**
+ * @brief Linear interpolation between two durations (seconds), in clock
+ * ticks: `fastest` with no enemy left, `slowest` with the full grid.
+ * @param aliveCount Living enemies (<= TOTAL_ENEMIES).
+ */
+TimerTime getSwarmInterval(float fastest, float slowest, unsigned aliveCount);
+
+/**
+ * @brief Destroys grid enemy `index` (enemies[] order): clears its `active`
+ * flag and its bits in `swarm->alive`, and speeds the swarm up at once
+ * (updateSwarmSpeed()).
+ * @param swarm Pointer to the Swarm.
+ * @param index Index in enemies[] (row * ENEMY_COLS + col).
+ */
+void killSwarmEnemy(Swarm *swarm, int index);
+
+/**
+ * @brief Hashes enemies[].active from scratch: the XOR of a random 64-bit
+ * key per active enemy (Zobrist hashing). killSwarmEnemy() XORs the key of
+ * the enemy out, which is how Swarm.enemyHash follows enemies[].
+ */
+uint64_t hashSwarmEnemies(const Swarm *swarm);
+
+/** @brief Marks the whole grid alive. */
+void fillSwarmAlive(SwarmAlive *alive);
+
+/** @brief Clears the bits of grid enemy `index` (row * ENEMY_COLS + col). */
+void clearSwarmAlive(SwarmAlive *alive, int index);
+
+/** @brief Number of living grid enemies (one popcount per row). */
+unsigned countSwarmAlive(const SwarmAlive *alive);
+
+/**
+ * @brief Horizontal extent of the living enemies.
+ * @param alive   The masks.
+ * @param originX X of enemies[0] (the grid moves in lockstep).
+ * @param left    Receives the left edge of the leftmost living column.
+ * @param right   Receives the right edge of the rightmost living column.
+ * @return false if no enemy is alive (edges left untouched).
+ */
+bool getSwarmEdges(const SwarmAlive *alive, Fixed originX, Fixed *left,
+                   Fixed *right);
+
+/**
+ * @brief Picks the enemy that fires: the bottom-most living enemy of the
+ * first non-empty column at or after `startCol` (wrapping around), i.e. the
+ * same choice as walking the columns and rows one by one.
+ * @param alive    The masks.
+ * @param startCol Column drawn at random, in [0, ENEMY_COLS).
+ * @return int The shooter's index in enemies[], or -1 if none is alive.
+ */
+int pickSwarmShooter(const SwarmAlive *alive, int startCol);
+
 /**
  * @brief Frees the memory allocated for the Swarm.
  * @param swarm Pointer to the Swarm to free.
@@ -159,31 +347,32 @@ Swarm *createSwarm(int level);
 void destroySwarm(Swarm *swarm);
 
 /**
- * @brief Updates the Swarm's position and state.
- * * Handles:
- * 1. Accumulating timers.
- * 2. Moving the entire grid horizontally if the timer triggers.
- * 3. Detecting screen edges and dropping the swarm down.
- * 4. Updating the Boss (if active).
+ * @brief Updates the Swarm's position and state, as its kind does it:
+ * - SWARM_GRID: moves the grid origin horizontally once moveInterval has
+ * passed since lastMoveAt, and drops it down at the screen edges.
+ * - SWARM_BOSS: moves the Boss (if active) and bounces it off the edges.
  * * @param swarm       Pointer to the Swarm.
- * @param deltaTime   Time elapsed since last frame.
+ * @param deltaTime   Time elapsed since last frame (seconds, Fixed).
+ * @param now         Clock of the World, deltaTime included.
  * @param screenWidth Logical width of the screen (for edge detection).
  */
-void updateSwarm(Swarm *swarm, float deltaTime, unsigned screenWidth);
+void updateSwarm(Swarm *swarm, Fixed deltaTime, TimerTime now,
+                 unsigned screenWidth);
 
 /**
  * @brief Attempts to make a random enemy fire a projectile.
  * * Logic:
- * - Checks if `shootTimer` > `shootCooldown`.
- * - If yes, picks a random column.
- * - Finds the bottom-most active enemy in that column.
- * - Spawns a projectile from that enemy.
+ * - Checks if `now` has reached `shootAt`.
+ * - If yes, sets the next shot `shootCooldown` later and lets the kind fire:
+ * - SWARM_GRID: picks a random column (from `swarm->rng`) and spawns a
+ * projectile from its bottom-most active enemy.
+ * - SWARM_BOSS: a spread of three projectiles from the Boss (if active).
  * * @param swarm       Pointer to the Swarm.
  * @param projectiles Pointer to the Projectile pool manager.
- * @param deltaTime   Time elapsed since last frame.
+ * @param now         Clock of the World.
  * @return true if a shot was fired, false otherwise.
  */
-bool enemyAttemptShoot(Swarm *swarm, Projectiles *projectiles, float deltaTime);
+bool enemyAttemptShoot(Swarm *swarm, Projectiles *projectiles, TimerTime now);
 
 /**
  * @brief Checks if the level is cleared.
@@ -0,0 +1,171 @@
+#ifndef ENV_SERVER_H
+#define ENV_SERVER_H
+
+#include "spaceinvaders_core.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file env_server.h
+ * @brief Multi-process environment server over POSIX shared memory.
+ *
+ * M worker processes each host K games. The trainer (client) and each
+ * worker share one channel made of two rings of ENV_RING_SLOTS slots:
+ * a request ring (one EnvCommand per game) and a response ring (one
+ * EnvResult per game). The client writes the commands in place in the
+ * shared slot, the worker writes the observations in place: nothing is
+ * serialized or copied through the kernel.
+ *
+ * Both sides spin briefly on the ring counters before sleeping on a futex,
+ * and a futex wake is only issued when the other side is actually asleep.
+ * While the trainer keeps the workers busy, a step therefore costs no
+ * system call at all.
+ *
+ * The channel functions are exported by libspaceinvaders_core, so a
+ * trainer in another process can attachEnvServer() by name.
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Identifies an environment server mapping ("SIEV" in ASCII). */
+#define ENV_SERVER_MAGIC 0x56454953u
+
+/** @brief Layout version of the shared mapping. */
+#define ENV_SERVER_VERSION 2u
+
+/** @brief Requests a client may have in flight per worker. */
+#define ENV_RING_SLOTS 8
+
+/** @brief Polls of a ring counter before sleeping on the futex. */
+#define ENV_SERVER_SPIN 4096
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief What a worker must do with one of its games. */
+typedef enum {
+  ENV_COMMAND_STEP = 0, /**< siStep() with `action`. */
+  ENV_COMMAND_RESET = 1 /**< siReset() with `seed`. */
+} EnvCommandType;
+
+/** @brief Input of one game for one request (lives in shared memory). */
+typedef struct {
+  SiAction action; /**< Used by ENV_COMMAND_STEP. */
+  uint32_t type;   /**< EnvCommandType. */
+  uint32_t frames; /**< Ticks to advance with the same action (>= 1). */
+  uint64_t seed;   /**< Used by ENV_COMMAND_RESET. */
+} EnvCommand;
+
+/** @brief Output of one game for one request (lives in shared memory). */
+typedef struct {
+  SiObservation observation; /**< State after the command. */
+  uint32_t events;           /**< OR of SI_EVENT_* over all ticks. */
+  uint32_t reserved;
+} EnvResult;
+
+/** @brief Handle on a server mapping (owner or attached client). */
+typedef struct EnvServer EnvServer;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Creates the shared mapping and forks the worker processes, then
+ * waits until every worker has created its games.
+ * Worker `w` hosts games seeded `seed + w * worldsPerWorker + i`.
+ * The name must be free: an existing mapping (a live server, or one left
+ * by a crashed owner) is never replaced, and errno is then EEXIST. See
+ * removeEnvServer() to clean up after a crash.
+ * @param name            POSIX shm name (e.g., "/spaceinvaders").
+ * @param workers         Number of worker processes (M).
+ * @param worldsPerWorker Games hosted by each worker (K).
+ * @param level           Starting level of every game.
+ * @param seed            Base seed.
+ * @return EnvServer* Owner handle, or NULL on failure.
+ */
+SI_API EnvServer *createEnvServer(const char *name, int workers,
+                                  int worldsPerWorker, int32_t level,
+                                  uint64_t seed);
+
+/**
+ * @brief Removes the shm name of a server whose owner died without
+ * destroyEnvServer(). Clients still attached keep their mapping; a live
+ * server would lose its name, so only call it when none runs.
+ * @param name POSIX shm name given to createEnvServer().
+ * @return true if the name existed and was removed.
+ */
+SI_API bool removeEnvServer(const char *name);
+
+/**
+ * @brief Maps an existing server from another process.
+ * @param name POSIX shm name given to createEnvServer().
+ * @return EnvServer* Client handle, or NULL if the server does not exist
+ * or was built with another layout.
+ */
+SI_API EnvServer *attachEnvServer(const char *name);
+
+/**
+ * @brief Releases a handle.
+ * The owner also stops the workers, waits for them and removes the shm
+ * name. An attached client only unmaps.
+ * @param server The handle. Safe to pass NULL.
+ */
+SI_API void destroyEnvServer(EnvServer *server);
+
+/** @brief Number of worker processes (M). */
+SI_API int getEnvServerWorkers(const EnvServer *server);
+
+/** @brief Number of games per worker (K). */
+SI_API int getEnvServerWorlds(const EnvServer *server);
+
+/**
+ * @brief Blocks until every worker process has exited.
+ * For the owner of a server that external clients drive.
+ * @param server Owner handle.
+ */
+SI_API void waitEnvServer(EnvServer *server);
+
+/**
+ * @brief Asks the workers to exit (any handle may do it).
+ * @param server The handle.
+ */
+SI_API void shutdownEnvServer(EnvServer *server);
+
+/**
+ * @brief Returns the next free request slot of `worker`, to be filled in
+ * place with K commands.
+ * @param server The handle.
+ * @param worker Worker index (0 <= worker < M).
+ * @return EnvCommand* K commands, or NULL if ENV_RING_SLOTS requests are
+ * already in flight (consume responses first).
+ */
+SI_API EnvCommand *beginEnvRequest(EnvServer *server, int worker);
+
+/**
+ * @brief Publishes the slot returned by beginEnvRequest().
+ * @param server The handle.
+ * @param worker Worker index.
+ */
+SI_API void submitEnvRequest(EnvServer *server, int worker);
+
+/**
+ * @brief Waits for the oldest pending response of `worker`.
+ * @param server The handle.
+ * @param worker Worker index.
+ * @return const EnvResult* K results, valid until releaseEnvResponse(), or
+ * NULL if no request is pending or the server shut down.
+ */
+SI_API const EnvResult *waitEnvResponse(EnvServer *server, int worker);
+
+/**
+ * @brief Hands the response slot back to the ring.
+ * @param server The handle.
+ * @param worker Worker index.
+ */
+SI_API void releaseEnvResponse(EnvServer *server, int worker);
+
+#endif // ENV_SERVER_H
@@ -1,6 +1,8 @@
 #ifndef EXPLOSION_H
 #define EXPLOSION_H
 
+#include "fixed_point.h"
+#include "timer_wheel.h"
 #include <stdbool.h>
 
 /**
@@ -27,6 +29,12 @@
  */
 #define EXPLOSION_DURATION 0.3f
 
+/**
+ * @brief Number of sprite frames, each shown for an equal share of
+ * EXPLOSION_DURATION.
+ */
+#define EXPLOSION_FRAMES 3
+
 /**
  * @brief The width/height of the explosion sprite in pixels.
  */
@@ -40,18 +48,18 @@
  * @brief Represents a single explosion instance.
  */
 typedef struct {
-  float x; /**< X position of the explosion center. */
-  float y; /**< Y position of the explosion center. */
+  Fixed x; /**< X position of the explosion center. */
+  Fixed y; /**< Y position of the explosion center. */
 
-  /** * @brief Countdown timer for the effect.
-   * Starts at EXPLOSION_DURATION and decrements by deltaTime.
-   * When it reaches <= 0, the explosion is deactivated.
+  /** * @brief Clock time of the next frame change.
+   * Set to one frame after the spawn, then pushed back one frame at a time;
+   * when it passes the last frame, the explosion is deactivated.
    */
-  float timer;
+  TimerTime nextFrameAt;
 
   /**
    * @brief The current sprite frame to render.
-   * Typically calculated as: 0 (start), 1 (middle), 2 (end).
+   * 0 (start), 1 (middle), 2 (end).
    */
   int currentFrame;
 
@@ -77,32 +85,49 @@ typedef struct {
  */
 ExplosionManager *createExplosionManager(void);
 
+/**
+ * @brief Initializes an already allocated manager (e.g., embedded in a World).
+ * Sets all explosion slots to inactive, without any allocation.
+ * @param em Pointer to the manager.
+ */
+void initExplosionManager(ExplosionManager *em);
+
 /**
  * @brief Frees the memory allocated for the ExplosionManager.
  * @param em Pointer to the manager to free.
  */
 void destroyExplosionManager(ExplosionManager *em);
 
+/**
+ * @brief Moves one explosion to the frame it shows at `now`, or deactivates
+ * it once its last frame is over.
+ * @param explosion An active explosion whose `nextFrameAt` is reached.
+ * @param now       Clock of the World.
+ * @return true if the explosion is still playing (until `nextFrameAt`).
+ */
+bool advanceExplosion(Explosion *explosion, TimerTime now);
+
 /**
  * @brief Updates the state of all active explosions.
- * * This function:
- * 1. Decrements the timer of active explosions by `deltaTime`.
- * 2. Updates `currentFrame` based on how much time is left.
- * 3. Deactivates explosions whose timer has reached 0.
- * * @param em        Pointer to the ExplosionManager.
- * @param deltaTime Time elapsed since the last frame (seconds).
+ * Calls advanceExplosion() on those whose next frame is due; the others are
+ * left untouched.
+ * * @param em  Pointer to the ExplosionManager.
+ * @param now Clock of the World.
  */
-void updateExplosions(ExplosionManager *em, float deltaTime);
+void updateExplosions(ExplosionManager *em, TimerTime now);
 
 /**
  * @brief Spawns a new explosion at the specified coordinates.
  * * Scans the pool for the first available (inactive) slot.
  * If a slot is found, it initializes it with the given coordinates
- * and resets its timer. If the pool is full, the request is ignored.
- * * @param em Pointer to the ExplosionManager.
- * @param x  X coordinate for the explosion.
- * @param y  Y coordinate for the explosion.
+ * and starts its first frame at `now`. If the pool is full, the request is
+ * ignored.
+ * * @param em  Pointer to the ExplosionManager.
+ * @param x   X coordinate for the explosion.
+ * @param y   Y coordinate for the explosion.
+ * @param now Clock of the World.
+ * @return int The slot used, or -1 if the pool was full.
  */
-void spawnExplosion(ExplosionManager *em, float x, float y);
+int spawnExplosion(ExplosionManager *em, Fixed x, Fixed y, TimerTime now);
 
 #endif // EXPLOSION_H
\ No newline at end of file
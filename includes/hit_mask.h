@@ -0,0 +1,96 @@
+#ifndef HIT_MASK_H
+#define HIT_MASK_H
+
+#include "fixed_point.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file hit_mask.h
+ * @brief 1-bit hit masks: pixel-accurate shapes of the enemies and boss.
+ *
+ * A hitbox is a full rectangle, while the sprites are mostly transparent.
+ * Once the AABB test has passed, the narrow phase below tests the opaque
+ * pixels of the sprite instead. A mask is stored by columns, one 64-bit
+ * word each (bit y is row y): ORing the few columns under a projectile
+ * gives the rows it can meet, which are then cut to the rows it covers
+ * with a shift and an AND. The leading opaque row is a bit scan, with no
+ * loop over the rows.
+ *
+ * The masks are generated offline by tools/gen_sprite_masks.py
+ * (src/model/hit_mask_data.c), at the size of their entity, straight from
+ * the alpha channel of the full-size assets: each pixel averages the
+ * texels SDL stretches over it, and is opaque from half coverage up (the
+ * rasterizer's threshold). What is drawn is what can be hit, down to the
+ * pixel, even for the Boss whose asset is much larger than the screen.
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Largest mask, in pixels (a column is one HitMaskColumn). */
+#define HIT_MASK_MAX_WIDTH 64
+#define HIT_MASK_MAX_HEIGHT 64
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief One column of a mask: bit y is set if pixel y is opaque. */
+typedef uint64_t HitMaskColumn;
+
+/** @brief Entities tested pixel by pixel. */
+typedef enum {
+  HIT_MASK_ALIEN_1, /**< Enemy, arms down (ENEMY_WIDTH x ENEMY_HEIGHT). */
+  HIT_MASK_ALIEN_2, /**< Enemy, arms up. */
+  HIT_MASK_BOSS,    /**< Boss (BOSS_WIDTH x BOSS_HEIGHT). */
+  HIT_MASK_COUNT
+} HitMaskId;
+
+/** @brief Opaque pixels of a sprite stretched over its entity. */
+typedef struct {
+  int width;  /**< Pixel width (<= HIT_MASK_MAX_WIDTH). */
+  int height; /**< Pixel height (<= HIT_MASK_MAX_HEIGHT). */
+  HitMaskColumn columns[HIT_MASK_MAX_WIDTH];
+} HitMask;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/** @brief Every mask, indexed by HitMaskId (generated data). */
+extern const HitMask hitMaskData[HIT_MASK_COUNT];
+
+/** @brief Mask of an entity. */
+const HitMask *getHitMask(HitMaskId id);
+
+/**
+ * @brief Tells whether pixel (x, y) of a mask is opaque.
+ * @param x Column in [0, width).
+ * @param y Row in [0, height).
+ */
+bool isHitMaskPixelSet(const HitMask *mask, int x, int y);
+
+/**
+ * @brief Tells whether a box (left, top, w, h), given relative to the
+ * top-left corner of the mask, covers an opaque pixel. Pixel (x, y)
+ * covers [x, x + 1) x [y, y + 1); like checkOverlap(), touching edges do
+ * not count.
+ */
+bool testHitMask(const HitMask *mask, Fixed left, Fixed top, Fixed w,
+                 Fixed h);
+
+/**
+ * @brief Swept version of testHitMask(): a box (w, h) moving from
+ * (x0, y0) to (x1, y1), relative to the mask.
+ * A vertical path (every bullet that can hit an enemy) is solved exactly
+ * from the leading opaque row; other paths are tested in sub-steps of at
+ * most one pixel.
+ * @param toi [Output] Time of first contact, in [0, FIXED_ONE].
+ * @return true if the box covers an opaque pixel at some point of the path.
+ */
+bool sweepHitMask(const HitMask *mask, Fixed x0, Fixed y0, Fixed x1,
+                  Fixed y1, Fixed w, Fixed h, Fixed *toi);
+
+#endif // HIT_MASK_H
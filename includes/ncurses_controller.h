@@ -4,6 +4,7 @@
 #include "game_state.h"
 #include "player.h"
 #include "projectile.h"
+#include "sim_clock.h"
 #include <stdbool.h>
 
 /**
@@ -24,10 +25,12 @@
  * @brief Processes keyboard input for the terminal interface.
  *
  * Reads characters from the standard input (`getch()`). Supports:
- * - **Arrow Keys / 'a', 'd':** Player movement.
+ * - **Arrow Keys / 'a', 'd':** Player movement (sets the direction, the
+ *   simulation steps move the ship).
  * - **Space:** Shooting.
  * - **'p':** Pause/Unpause.
  * - **Enter:** Start Game / Restart.
+ * - **'[' / ']' / '0' / 't':** Slower, faster, real time, turbo.
  * - **'q':** Quit.
  *
  * @param player     Pointer to the player object to control.
@@ -36,13 +39,16 @@
  * @param needsReset Pointer to a boolean flag. The controller sets this to true
  * when the user requests a game restart (e.g., pressing Enter
  * at the Game Over screen), signaling the main loop to reset entities.
- * @param deltaTime  Time elapsed since last frame (used for input buffering or
- * cooldowns).
+ * @param deltaTime  Real time elapsed since last frame (releases a movement
+ * key once its repeats stop).
+ * @param clock      Pointer to the simulation clock (time scale keys).
+ * @param now        Clock of the World (weapon cooldown).
  *
  * @return true  If the game loop should continue.
  * @return false If the user requested to Quit ('q').
  */
 bool handleNcursesInput(Player *player, Projectiles *bullets, GameState *state,
-                        bool *needsReset, float deltaTime);
+                        bool *needsReset, float deltaTime, SimClock *clock,
+                        TimerTime now);
 
 #endif // NCURSES_CONTROLLER_H
\ No newline at end of file
@@ -14,7 +14,7 @@
  * @brief Handles the text-based rendering of the game (The "View" in MVC).
  * * This module manages the Ncurses library lifecycle. It is responsible for:
  * - Setting up the terminal (raw mode, no echo, invisible cursor).
- * - Translating game entity float coordinates into integer terminal rows/cols.
+ * - Translating game entity fixed-point coordinates into terminal rows/cols.
  * - Drawing ASCII characters to represent game objects (e.g., '^' for player,
  * 'M' for aliens).
  * - Handling screen refreshes and window management.
@@ -4,6 +4,7 @@
 #include "bunker.h"
 #include "enemy.h"
 #include "explosion.h"
+#include "hit_mask.h"
 #include "player.h"
 #include "projectile.h"
 #include <stdbool.h>
@@ -16,16 +17,173 @@
  * between the various game entities (Axis-Aligned Bounding Box checks).
  * It modifies the state of entities directly (e.g., setting `active = false`)
  * and triggers events like explosions or game over states.
+ *
+ * Projectiles are tested along the whole path they flew during the frame
+ * (from prevX / prevY to x / y), not only at their end position, so that a
+ * long frame cannot make a bullet tunnel through a target. Every hit has a
+ * time of impact (the fraction of the path flown before contact) and hits
+ * are applied earliest first. Targets are taken at their end-of-frame
+ * position.
+ *
+ * Enemies and the boss are hit pixel by pixel: a path that crosses their
+ * box is then tested against their hit mask (hit_mask.h), so a bullet
+ * that visibly misses does not score.
+ */
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief What a projectile ran into. */
+typedef enum {
+  IMPACT_NONE,
+  IMPACT_BUNKER,
+  IMPACT_ENEMY,
+  IMPACT_BOSS,
+  IMPACT_PLAYER
+} ImpactKind;
+
+/** @brief First contact of a projectile along its path. */
+typedef struct {
+  ImpactKind kind; /**< IMPACT_NONE if the path is clear. */
+  int target;      /**< Bunker or enemy index (0 otherwise). */
+  Fixed toi;       /**< Time of impact: fraction of the path flown. */
+  int x;           /**< IMPACT_BUNKER: crater centre, in bunker pixels. */
+  int y;           /**< IMPACT_BUNKER: impact row, in bunker pixels. */
+  int slot;        /**< Projectile slot (set by the caller). */
+} Impact;
+
+/**
+ * @brief Everything a projectile can hit, as plain values, so that the
+ * same tests serve a World and a WorldBatch game.
  */
+typedef struct {
+  const BunkerManager *bunkers; /**< May be NULL (no shields). */
+  const SwarmAlive *alive;      /**< Living enemies of the grid. */
+  Fixed originX;                /**< Swarm originX. */
+  Fixed originY;                /**< Swarm originY. */
+  bool animationFrame;          /**< Swarm animationFrame (enemy mask). */
+  bool bossActive;              /**< SWARM_BOSS alive: shields the grid. */
+  Fixed bossX;                  /**< Boss hitbox. */
+  Fixed bossY;
+  Fixed bossWidth;
+  Fixed bossHeight;
+  Fixed playerX; /**< Player hitbox. */
+  Fixed playerY;
+  Fixed playerWidth;
+  Fixed playerHeight;
+} ImpactTargets;
 
 // ==========================================
 //               FUNCTIONS
 // ==========================================
 
+/**
+ * @brief Axis-Aligned Bounding Box overlap test.
+ * @return true if the rectangle (x1, y1, w1, h1) intersects (x2, y2, w2, h2).
+ */
+bool checkOverlap(Fixed x1, Fixed y1, Fixed w1, Fixed h1, Fixed x2, Fixed y2,
+                  Fixed w2, Fixed h2);
+
+/**
+ * @brief Grid cells of the swarm a box may touch (level 1).
+ * The swarm moves in lockstep, so the cell of a point is found by
+ * subtracting the grid origin (Swarm originX / originY) and dividing by the
+ * pitch. The division is exact on fixed-point values, so the range holds
+ * exactly the cells whose box overlaps (x, y, w, h), live or not.
+ * @param originX X of slot 0 (row 0, column 0).
+ * @param originY Y of slot 0.
+ * @param x, y, w, h The box (e.g., a projectile).
+ * @param col0, row0, col1, row1 [Output] Inclusive range of cells.
+ * @return false if the box cannot touch any cell of the grid.
+ */
+bool getSwarmCellRange(Fixed originX, Fixed originY, Fixed x, Fixed y,
+                       Fixed w, Fixed h, int *col0, int *row0, int *col1,
+                       int *row1);
+
+/**
+ * @brief First active enemy (lowest index) overlapping a box, found by
+ * testing only the cells given by getSwarmCellRange() (at most 2 x 2 for a
+ * projectile).
+ * @return int Index in swarm->enemies, or -1 if none.
+ */
+int findSwarmHit(const Swarm *swarm, Fixed x, Fixed y, Fixed w, Fixed h);
+
+/**
+ * @brief Reference for findSwarmHit(): scans all TOTAL_ENEMIES enemies.
+ * Kept for the differential check (`spaceinvaders hittest`).
+ * @return int Index in swarm->enemies, or -1 if none.
+ */
+int scanSwarmHit(const Swarm *swarm, Fixed x, Fixed y, Fixed w, Fixed h);
+
+/**
+ * @brief Swept AABB test: a box (w, h) moving from (x0, y0) to (x1, y1)
+ * against a still box (bx, by, bw, bh).
+ * Slab method on the target grown by the moving box; like checkOverlap(),
+ * boxes that only touch do not collide. A box that does not move is
+ * tested where it stands.
+ * @param toi [Output] Time of first overlap, in [0, FIXED_ONE], rounded
+ * towards zero.
+ * @return true if the boxes overlap at some point of the path.
+ */
+bool sweepBox(Fixed x0, Fixed y0, Fixed x1, Fixed y1, Fixed w, Fixed h,
+              Fixed bx, Fixed by, Fixed bw, Fixed bh, Fixed *toi);
+
+/**
+ * @brief First living enemy met by a box moving from (x0, y0) to (x1, y1),
+ * testing only the cells getSwarmCellRange() gives for the swept area.
+ * An enemy whose box the path crosses is then tested pixel by pixel
+ * (sweepHitMask()). Ties go to the lowest index.
+ * @param mask Hit mask of the enemies (current animation frame).
+ * @param toi  [Output] Time of impact of the enemy returned.
+ * @return int Enemy index, or -1 if none.
+ */
+int sweepSwarmHit(const SwarmAlive *alive, Fixed originX, Fixed originY,
+                  const HitMask *mask, Fixed x0, Fixed y0, Fixed x1, Fixed y1,
+                  Fixed w, Fixed h, Fixed *toi);
+
+/**
+ * @brief First target met by a projectile along its path.
+ * Every projectile is stopped by the bunkers; one moving up (velocityY < 0)
+ * may then hit the boss (if active) or the grid, one moving down the
+ * player. Enemies and the boss are tested against their hit mask, the
+ * player against its box. On a tie, the bunker wins.
+ */
+Impact findImpact(const ImpactTargets *targets, Fixed x0, Fixed y0, Fixed x1,
+                  Fixed y1, Fixed w, Fixed h, Fixed velocityY);
+
+/**
+ * @brief findImpact() for `count` projectile paths given as arrays (a
+ * Projectiles pool or a slice of a WorldBatch), from (x0, y0) to (x1, y1).
+ * The paths are first screened on their heights, in one branch-free pass:
+ * only those reaching the band of a target (bunker rows, the grid or the
+ * Boss going up, the player going down) run the full test.
+ * @param impacts [Output] The impacts found, in slot order, `slot` set to
+ * the index of the path (at most `count` <= MAX_PROJECTILES).
+ * @return int Number of impacts written.
+ */
+int findImpacts(const ImpactTargets *targets, const Fixed *x0,
+                const Fixed *y0, const Fixed *x1, const Fixed *y1,
+                const Fixed *velocityY, int count, Impact *impacts);
+
+/** @brief Tells whether two impacts name the same contact. */
+bool isSameImpact(const Impact *a, const Impact *b);
+
+/**
+ * @brief Earliest impact of an array (lowest slot on a tie), so that the
+ * array can be kept unordered.
+ * @return int Index in `impacts`, or -1 if `count` is 0.
+ */
+int nextImpact(const Impact *impacts, int count);
+
 /**
  * @brief Performs all collision checks for a single frame.
  *
- * This function iterates through all active entities and checks:
+ * The impacts of all live projectiles are found first, then applied in
+ * time order: once one has been applied, the next ones are searched again
+ * before being applied, since the target may be gone (the impact is then
+ * queued again with its new time). The bullets that hit are removed from
+ * the pool at the end. This function checks:
  * 1. **Projectiles vs Enemies:** If a player bullet hits an alien, both are
  * destroyed, an explosion is spawned, and the score is updated.
  * 2. **Projectiles vs Player:** If an enemy bullet hits the player, damage is
@@ -39,19 +197,20 @@
  * @param player      Pointer to the Player entity (to check if hit).
  * @param swarm       Pointer to the Swarm (to check if individual enemies are
  * hit).
- * @param projectiles Pointer to the Projectile pool (checks all active
+ * @param projectiles Pointer to the Projectile pool (checks all live
  * bullets).
  * @param explosions  Pointer to the Explosion Manager (to spawn effects on
  * hit).
  * @param bunkers     Pointer to the Bunker Manager (to check shield damage).
  * @param enemyHit    [Output] Pointer to a bool flag. Set to `true` if *any*
  * enemy was destroyed this frame (useful for playing sound effects).
+ * @param now         Clock of the World (start of the explosions).
  *
  * @return true  If the Player was hit and died (Game Over condition).
  * @return false If the Player survived the frame.
  */
 bool checkCollisions(Player *player, Swarm *swarm, Projectiles *projectiles,
                      ExplosionManager *explosions, BunkerManager *bunkers,
-                     bool *enemyHit);
+                     bool *enemyHit, TimerTime now);
 
 #endif // PHYSICS_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define PLAYER_H
 
 #include "projectile.h"
+#include "timer_wheel.h"
 #include <stdbool.h>
 
 /**
@@ -18,10 +19,10 @@
 // ==========================================
 
 /**
- * @brief The movement speed of the player in pixels per second.
+ * @brief The movement speed of the player in pixels per second (Fixed).
  * Used for calculating smooth movement: position += speed * deltaTime.
  */
-#define PLAYER_SPEED 300.0f
+#define PLAYER_SPEED FIXED(300)
 
 /**
  * @brief Time in seconds required between two shots (Fire Rate).
@@ -29,12 +30,17 @@
 #define PLAYER_SHOOT_COOLDOWN 0.3f
 
 /**
- * @brief The fixed Y position of the player (vertical lock).
- * @note Standard screen height is usually 600px. A value of 200.0f
- * puts the player in the top half. For a classic feel, consider 500.0f or
- * 550.0f.
+ * @brief Time in seconds between two frames of the exhaust animation.
  */
-#define Y_AXIS 550.0f
+#define PLAYER_ANIM_PERIOD 0.3f
+
+/**
+ * @brief The fixed Y position of the player (vertical lock, Fixed).
+ * @note Standard screen height is usually 600px. A value of 200
+ * puts the player in the top half. For a classic feel, consider 500 or
+ * 550.
+ */
+#define Y_AXIS FIXED(550)
 
 /**
  * @brief The initial number of lives/health the player starts with.
@@ -59,22 +65,22 @@ typedef enum {
  */
 typedef struct _player {
   // --- Physics & Transform ---
-  float x; /**< Horizontal position (float for smooth sub-pixel physics). */
-  float y; /**< Vertical position (fixed lock). */
+  Fixed x; /**< Horizontal position (Fixed for smooth sub-pixel physics). */
+  Fixed y; /**< Vertical position (fixed lock). */
   unsigned height; /**< Sprite height in pixels (hitbox). */
   unsigned width;  /**< Sprite width in pixels (hitbox). */
-  float velocityX; /**< Current horizontal speed vector (pixels/sec). */
+  Fixed velocityX; /**< Current horizontal speed vector (pixels/sec). */
 
   // --- Gameplay State ---
-  float shootTimer;   /**< Countdown timer for reloading. 0.0f means Ready. */
-  unsigned health;    /**< Current lives remaining. Game Over if 0. */
-  unsigned score;     /**< Current score accumulated in this session. */
-  unsigned highScore; /**< All-time high score loaded from storage. */
+  TimerTime shootReadyAt; /**< Clock time from which the weapon can fire. */
+  unsigned health;        /**< Current lives remaining. Game Over if 0. */
+  unsigned score;         /**< Current score accumulated in this session. */
+  unsigned highScore;     /**< All-time high score loaded from storage. */
 
   // --- Animation State ---
-  float animTimer; /**< Timer to toggle sprite frames. */
-  int animFrame;   /**< Current frame index (for sprite sheet rendering). */
-  int animDir;     /**< Direction of animation playback. */
+  TimerTime animAt; /**< Clock time of the next sprite frame. */
+  int animFrame;    /**< Current frame index (for sprite sheet rendering). */
+  int animDir;      /**< Direction of animation playback. */
 
 } Player;
 
@@ -91,7 +97,19 @@ typedef struct _player {
  * @return Player* Pointer to the newly allocated Player struct, or NULL on
  * failure.
  */
-Player *createPlayer(float xAxis, unsigned height, unsigned width);
+Player *createPlayer(Fixed xAxis, unsigned height, unsigned width);
+
+/**
+ * @brief Initializes an already allocated Player (e.g., embedded in a World).
+ * Same starting values as createPlayer(), without any allocation. The
+ * timers are set for a clock starting at 0 (a new World).
+ *
+ * @param player Pointer to the Player to (re)initialize.
+ * @param xAxis  The starting X coordinate.
+ * @param height The height of the player sprite.
+ * @param width  The width of the player sprite.
+ */
+void initPlayer(Player *player, Fixed xAxis, unsigned height, unsigned width);
 
 /**
  * @brief Frees the memory allocated for the player.
@@ -110,26 +128,32 @@ void destroyPlayer(Player *player);
 void setPlayerDirection(Player *player, Direction direction);
 
 /**
- * @brief Updates the player's physics and cooldowns.
+ * @brief Updates the player's physics and animation.
  *
  * This function:
- * 1. Decrements the `shootTimer` by `deltaTime`.
- * 2. Updates position: `x += velocity * deltaTime`.
- * 3. Clamps the position so the player cannot move off-screen (0 to
+ * 1. Updates position: `x += velocity * deltaTime`.
+ * 2. Clamps the position so the player cannot move off-screen (0 to
  * screenWidth).
+ * 3. Moves to the next exhaust frame once `animAt` is reached.
+ *
+ * The weapon cooldown needs no update: it is a deadline (`shootReadyAt`).
  *
  * @param player      Pointer to the Player.
- * @param deltaTime   Time passed since the last frame (seconds).
+ * @param deltaTime   Time passed since the last frame (seconds, Fixed).
+ * @param now         Clock of the World, deltaTime included.
  * @param screenWidth The logical width of the screen (for boundary checks).
  */
-void updatePlayer(Player *player, float deltaTime, unsigned screenWidth);
+void updatePlayer(Player *player, Fixed deltaTime, TimerTime now,
+                  unsigned screenWidth);
 
 /**
- * @brief Internal helper to check if the weapon is ready.
+ * @brief Internal helper to check if the weapon is ready, and arm the
+ * cooldown if it is.
  * @param player Pointer to the Player.
- * @return true if `shootTimer` <= 0.
+ * @param now    Clock of the World.
+ * @return true if `now` has reached `shootReadyAt`.
  */
-bool canPlayerShoot(Player *player);
+bool canPlayerShoot(Player *player, TimerTime now);
 
 /**
  * @brief Attempts to fire a projectile.
@@ -137,13 +161,14 @@ bool canPlayerShoot(Player *player);
  * Checks cooldown logic. If ready:
  * 1. Finds a free slot in the `Projectiles` pool.
  * 2. Spawns a new bullet at the player's center X.
- * 3. Resets `shootTimer` to `PLAYER_SHOOT_COOLDOWN`.
+ * 3. Sets `shootReadyAt` to `now` + `PLAYER_SHOOT_COOLDOWN`.
  *
  * @param player      Pointer to the Player.
  * @param projectiles Pointer to the Projectile pool manager.
+ * @param now         Clock of the World (World.clock).
  * @return true  If the shot was fired successfully.
  * @return false If the weapon is cooling down or the projectile pool is full.
  */
-bool playerShoot(Player *player, Projectiles *projectiles);
+bool playerShoot(Player *player, Projectiles *projectiles, TimerTime now);
 
 #endif // PLAYER_H
\ No newline at end of file
@@ -1,15 +1,18 @@
 #ifndef PROJECTILE_H
 #define PROJECTILE_H
 
+#include "fixed_point.h"
 #include <stdbool.h>
 
 /**
  * @file projectile.h
  * @brief Manages the "Bullet Hell" aspects of the game.
- * * This module implements an Object Pool for projectiles. Instead of
- * allocating and freeing memory every time a gun is fired, a fixed array of
- * `Projectile` structs is created at startup. Spawning a bullet simply involves
- * finding an inactive slot in this array and turning it on.
+ * * This module implements an Object Pool for projectiles, in
+ * Structure-of-Arrays form: one array per field (x, y, velocities), so that
+ * moving every bullet is one straight loop the compiler vectorizes. The
+ * live bullets are kept densely packed in slots [0, count): spawning appends
+ * at `count`, and a bullet is removed by moving the last one into its slot
+ * (swap-remove). Both are O(1), and no loop ever visits a free slot.
  */
 
 // ==========================================
@@ -17,15 +20,20 @@
 // ==========================================
 
 /**
- * @brief Maximum number of simultaneous bullets on screen (Player + Enemies).
- * If the pool is full, new firing attempts are ignored.
+ * @brief Maximum number of simultaneous bullets on screen (Player + Enemies),
+ * i.e. the largest capacity of a pool (a pool is a flat struct, so that a
+ * World can be copied with memcpy). If the pool is full, new firing
+ * attempts are ignored.
  */
 #define MAX_PROJECTILES 20
 
 /**
- * @brief Vertical speed of the bullets in pixels per second.
+ * @brief Vertical speed of the bullets in pixels per second (Fixed).
  */
-#define PROJECTILE_SPEED 500.0f
+#define PROJECTILE_SPEED FIXED(500)
+
+/** @brief Horizontal speed of the Boss's diagonal bullets (Fixed). */
+#define PROJECTILE_SPREAD_SPEED FIXED(150)
 
 /**
  * @brief Width of the bullet sprite/rect in pixels.
@@ -52,28 +60,23 @@ typedef enum _DirectionProjectile {
 } DirectionProjectile;
 
 /**
- * @brief Structure representing a single projectile (bullet).
- */
-typedef struct _Projectile {
-  float x;         /**< Current X position. */
-  float y;         /**< Current Y position. */
-  float w;         /**< Width (hitbox). */
-  float h;         /**< Height (hitbox). */
-  float velocityY; /**< Vertical speed component. */
-  float velocityX; /**< Horizontal speed component (usually 0). */
-  bool active; /**< true if this bullet is currently flying; false if available.
-                */
-} Projectile;
-
-/**
- * @brief Container structure that holds the pool of projectiles.
+ * @brief Dense pool of projectiles: bullet `i` (0 <= i < count) is
+ * (x[i], y[i]), flying at (velocityX[i], velocityY[i]). All bullets share
+ * the PROJECTILE_WIDTH x PROJECTILE_HEIGHT hitbox.
  */
 typedef struct _Projectiles {
-  /** @brief The fixed-size memory pool. */
-  Projectile projectiles[MAX_PROJECTILES];
-
-  /** @brief The capacity of the pool (usually MAX_PROJECTILES). */
+  Fixed x[MAX_PROJECTILES];         /**< Current X positions. */
+  Fixed y[MAX_PROJECTILES];         /**< Current Y positions. */
+  Fixed velocityX[MAX_PROJECTILES]; /**< Horizontal speeds (usually 0). */
+  Fixed velocityY[MAX_PROJECTILES]; /**< Vertical speeds (< 0: player's). */
+  Fixed prevX[MAX_PROJECTILES];     /**< X at the start of the last step. */
+  Fixed prevY[MAX_PROJECTILES];     /**< Y at the start of the last step. */
+
+  /** @brief Live bullets, in slots [0, count). */
   unsigned count;
+
+  /** @brief Usable slots, chosen at init (<= MAX_PROJECTILES). */
+  unsigned capacity;
 } Projectiles;
 
 // ==========================================
@@ -81,12 +84,19 @@ typedef struct _Projectiles {
 // ==========================================
 
 /**
- * @brief Allocates memory for the projectile pool and initializes it.
- * Sets all projectiles to `active = false`.
- * * @param count The size of the pool to initialize (usually MAX_PROJECTILES).
+ * @brief Allocates memory for the projectile pool and initializes it empty.
+ * * @param capacity Usable slots (clamped to 1..MAX_PROJECTILES).
  * @return Projectiles* Pointer to the newly allocated pool, or NULL on failure.
  */
-Projectiles *createProjectiles(unsigned count);
+Projectiles *createProjectiles(unsigned capacity);
+
+/**
+ * @brief Initializes an already allocated pool (e.g., embedded in a World)
+ * as empty, without any allocation.
+ * @param projectiles Pointer to the pool.
+ * @param capacity    Usable slots (clamped to 1..MAX_PROJECTILES).
+ */
+void initProjectiles(Projectiles *projectiles, unsigned capacity);
 
 /**
  * @brief Frees the memory allocated for the projectile pool.
@@ -95,30 +105,57 @@ Projectiles *createProjectiles(unsigned count);
 void destroyProjectiles(Projectiles *projectiles);
 
 /**
- * @brief Spawns a projectile from the pool.
- * * Scans the array for the first inactive slot. If found:
- * 1. Sets position to (x, y).
- * 2. Sets velocity based on `direction` (Up for player, Down for enemies).
- * 3. Sets `active = true`.
+ * @brief Velocity of a bullet fired in a given direction: straight up or
+ * down at PROJECTILE_SPEED, or down and sideways for the boss spread.
+ * @param direction Flight path (MOVE_UP, MOVE_DOWN, etc.).
+ * @param vx        [Output] Horizontal speed.
+ * @param vy        [Output] Vertical speed.
+ */
+void getProjectileVelocity(DirectionProjectile direction, Fixed *vx,
+                           Fixed *vy);
+
+/**
+ * @brief Spawns a projectile in the first free slot (slot `count`), O(1).
  * * @param projectiles Pointer to the pool.
  * @param x           Starting X coordinate (center of the shooter).
  * @param y           Starting Y coordinate (nozzle of the shooter).
  * @param direction   Enum defining flight path (MOVE_UP, MOVE_DOWN, etc.).
+ * @return true if the bullet was spawned, false if the pool is full.
  */
-void spawnProjectile(Projectiles *projectiles, float x, float y,
+bool spawnProjectile(Projectiles *projectiles, Fixed x, Fixed y,
                      DirectionProjectile direction);
 
 /**
- * @brief Updates the position of all active projectiles.
+ * @brief Spawns `n` projectiles from the same point (e.g., the boss's
+ * 3-way spread), in the order of `directions`, with one capacity check.
+ * @return unsigned Number of bullets spawned (fewer if the pool fills up).
+ */
+unsigned spawnProjectiles(Projectiles *projectiles, Fixed x, Fixed y,
+                          const DirectionProjectile *directions, unsigned n);
+
+/**
+ * @brief Removes bullet `index`, O(1): the last bullet moves into its slot.
+ * Callers iterating the pool must visit slot `index` again.
+ * @param projectiles Pointer to the pool.
+ * @param index       Slot of the bullet (< count).
+ */
+void killProjectile(Projectiles *projectiles, unsigned index);
+
+/**
+ * @brief Updates the position of all live projectiles.
  * * This function:
- * 1. Moves active bullets: `y += velocity * deltaTime`.
- * 2. Checks bounds: If a bullet leaves the screen (top or bottom),
- * it is deactivated (`active = false`) and returns to the pool.
+ * 1. Checks bounds: a bullet that left the screen during the previous step
+ * is removed from the pool (killProjectile()). It is kept for the step in
+ * which it leaves, so that the collision pass still sees the whole path it
+ * flew (see checkCollisions()).
+ * 2. Moves the other bullets: `y += velocity * deltaTime`, remembering the
+ * start of the step in (prevX, prevY). This is one straight loop over the
+ * live slots.
  * * @param projectiles  Pointer to the pool.
- * @param deltaTime    Time elapsed since last frame (seconds).
+ * @param deltaTime    Time elapsed since last frame (seconds, Fixed).
  * @param screenHeight Logical height of the screen (for boundary checks).
  */
-void updateProjectiles(Projectiles *projectiles, float deltaTime,
+void updateProjectiles(Projectiles *projectiles, Fixed deltaTime,
                        unsigned screenHeight);
 
-#endif // PROJECTILE_H
\ No newline at end of file
+#endif // PROJECTILE_H
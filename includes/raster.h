@@ -0,0 +1,96 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include "bunker.h"
+#include "enemy.h"
+#include "explosion.h"
+#include "player.h"
+#include "projectile.h"
+#include "world.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file raster.h
+ * @brief CPU-only rasterizer producing pixel observations without SDL.
+ *
+ * Draws the same layers as renderSDL() (player, projectiles, bunkers,
+ * enemies or Boss with its health bar, explosions) into a caller-supplied
+ * buffer at any resolution, e.g. 84x84 grayscale for an RL agent. The HUD
+ * (score, lives, menus) is left out: those values are already part of the
+ * numeric observation.
+ *
+ * Sprites come from the pre-downsampled masks of sprite_masks.h. When the
+ * rasterizer is created (or an entity changes size), every mask is scaled
+ * to the exact pixel size of its entity and turned into horizontal spans;
+ * drawing a frame is then only clipping and filling spans with SIMD stores.
+ */
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief Pixel format of the output buffer (value = bytes per pixel). */
+typedef enum {
+  RASTER_GRAY = 1, /**< One luminance byte per pixel. */
+  RASTER_RGB = 3   /**< R, G, B bytes per pixel. */
+} RasterFormat;
+
+/** @brief Scaled sprites and output geometry (opaque). */
+typedef struct Rasterizer Rasterizer;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Creates a rasterizer for a given output.
+ * @param width        Output width in pixels (e.g., 84).
+ * @param height       Output height in pixels (e.g., 84).
+ * @param format       RASTER_GRAY or RASTER_RGB.
+ * @param screenWidth  Logical width of the play field (e.g., 800).
+ * @param screenHeight Logical height of the play field (e.g., 600).
+ * @return Rasterizer* The rasterizer, or NULL on invalid arguments / no
+ * memory.
+ */
+Rasterizer *createRasterizer(unsigned width, unsigned height,
+                             RasterFormat format, unsigned screenWidth,
+                             unsigned screenHeight);
+
+/**
+ * @brief Frees the rasterizer.
+ * @param raster The rasterizer. Safe to pass NULL.
+ */
+void destroyRasterizer(Rasterizer *raster);
+
+/**
+ * @brief Size of one frame: width * height * bytes per pixel.
+ * The buffer is tightly packed, rows top to bottom.
+ */
+size_t getRasterFrameSize(const Rasterizer *raster);
+
+/**
+ * @brief Draws one frame from the Model objects (same arguments as
+ * renderSDL()). Any pointer but `player` may be NULL to skip a layer.
+ * @param raster      The rasterizer.
+ * @param pixels      Destination, getRasterFrameSize() bytes.
+ * @param player      The player ship.
+ * @param projectiles Bullet pool.
+ * @param swarm       Enemies or Boss.
+ * @param explosions  Visual effects.
+ * @param bunkers     Shields.
+ */
+void rasterize(Rasterizer *raster, uint8_t *pixels, const Player *player,
+               const Projectiles *projectiles, const Swarm *swarm,
+               const ExplosionManager *explosions,
+               const BunkerManager *bunkers);
+
+/**
+ * @brief Draws one frame of a World.
+ * @param raster The rasterizer.
+ * @param pixels Destination, getRasterFrameSize() bytes.
+ * @param world  The game.
+ */
+void rasterizeWorld(Rasterizer *raster, uint8_t *pixels, const World *world);
+
+#endif // RASTER_H
@@ -0,0 +1,168 @@
+#ifndef REMOTE_CONTROLLER_H
+#define REMOTE_CONTROLLER_H
+
+#include "spaceinvaders_core.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file remote_controller.h
+ * @brief Lets an external program (bot, trainer) drive N games over a
+ * compact binary protocol, through a UNIX domain socket or stdin/stdout.
+ *
+ * Every message starts with a 16-byte RemoteHeader, in host byte order
+ * (both transports are local). A request addresses the games
+ * [first, first + count):
+ * - REMOTE_HELLO: no payload. Reply: one RemoteHello.
+ * - REMOTE_RESET: `count` uint64_t seeds. Reply: observations.
+ * - REMOTE_STEP:  `count` action bytes (bits 0-1: SI_MOVE_*, bit 2: fire),
+ *   each game advances `frameSkip` ticks (0 counts as 1) with its action.
+ *   Reply: observations.
+ * - REMOTE_CLOSE: no payload. Reply: header only, then the server stops.
+ * Errors are answered with a REMOTE_ERROR header carrying a RemoteStatus.
+ * Observation replies carry a uint32_t byte count after the header, then
+ * the `count` observations, so a client can read them in one call.
+ *
+ * Observations are delta-encoded: both sides keep the last SiObservation
+ * of every game, seen as an array of 32-bit words, and only the changed
+ * words travel. One observation on the wire is:
+ *   uint32_t events; uint16_t segments; uint16_t reserved;
+ *   then `segments` times: uint16_t offset; uint16_t length; uint32_t
+ *   words[length];
+ * On connection and after a reset the reference is an all-zero observation.
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief First field of every message ("SIP1" in ASCII). */
+#define REMOTE_MAGIC 0x31504953u
+
+/** @brief Bits of a REMOTE_STEP action byte. */
+#define REMOTE_ACTION_MOVE_MASK 0x3u
+#define REMOTE_ACTION_FIRE 0x4u
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief Message types. */
+typedef enum {
+  REMOTE_HELLO = 1,
+  REMOTE_RESET = 2,
+  REMOTE_STEP = 3,
+  REMOTE_CLOSE = 4,
+  REMOTE_ERROR = 255
+} RemoteMessageType;
+
+/** @brief Status carried by a REMOTE_ERROR reply. */
+typedef enum {
+  REMOTE_OK = 0,
+  REMOTE_BAD_MAGIC = 1, /**< Stream out of sync: the server hangs up. */
+  REMOTE_BAD_TYPE = 2,  /**< Unknown message type. */
+  REMOTE_BAD_RANGE = 3  /**< [first, first + count) is not a valid range. */
+} RemoteStatus;
+
+/** @brief Header of every request and reply (16 bytes). */
+typedef struct {
+  uint32_t magic;     /**< REMOTE_MAGIC. */
+  uint8_t type;       /**< RemoteMessageType. */
+  uint8_t status;     /**< RemoteStatus (replies only). */
+  uint16_t frameSkip; /**< REMOTE_STEP: ticks per action. */
+  uint32_t first;     /**< First game addressed. */
+  uint32_t count;     /**< Number of games addressed. */
+} RemoteHeader;
+
+/** @brief Payload of the REMOTE_HELLO reply. */
+typedef struct {
+  uint32_t apiVersion;      /**< SI_API_VERSION. */
+  uint32_t worldCount;      /**< Games hosted by the server. */
+  uint32_t observationSize; /**< sizeof(SiObservation). */
+  uint32_t reserved;
+} RemoteHello;
+
+/** @brief Client side of the protocol (opaque). */
+typedef struct RemoteClient RemoteClient;
+
+// ==========================================
+//               SERVER
+// ==========================================
+
+/**
+ * @brief Creates a listening UNIX stream socket at `path`.
+ * An existing socket file at `path` is replaced.
+ * @param path Filesystem path of the socket.
+ * @return int The listening descriptor, or -1 on failure.
+ */
+int openRemoteSocket(const char *path);
+
+/**
+ * @brief Hosts `worldCount` games and answers requests until REMOTE_CLOSE,
+ * end of stream or a protocol error.
+ * Each reply is written with a single write() call.
+ * @param inFd       Where requests are read (socket or stdin).
+ * @param outFd      Where replies are written (socket or stdout).
+ * @param worldCount Number of games.
+ * @param level      Starting level of every game.
+ * @param seed       Game `i` is created with `seed + i`.
+ * @return int 0 on a clean close, -1 on error.
+ */
+int serveRemote(int inFd, int outFd, int worldCount, int32_t level,
+                uint64_t seed);
+
+// ==========================================
+//               CLIENT
+// ==========================================
+
+/**
+ * @brief Connects to a server over two descriptors and sends REMOTE_HELLO.
+ * @param inFd  Where replies are read.
+ * @param outFd Where requests are written.
+ * @return RemoteClient* The client, or NULL on failure / version mismatch.
+ */
+RemoteClient *createRemoteClient(int inFd, int outFd);
+
+/**
+ * @brief Sends REMOTE_CLOSE (if still connected) and frees the client.
+ * The descriptors are not closed.
+ * @param client The client. Safe to pass NULL.
+ */
+void destroyRemoteClient(RemoteClient *client);
+
+/** @brief Number of games hosted by the server. */
+int getRemoteWorldCount(const RemoteClient *client);
+
+/**
+ * @brief Last decoded observation of game `index`.
+ * @return const SiObservation* The observation, or NULL if out of range.
+ */
+const SiObservation *getRemoteObservation(const RemoteClient *client,
+                                          int index);
+
+/** @brief Bytes received so far (headers + delta observations). */
+uint64_t getRemoteBytesReceived(const RemoteClient *client);
+
+/**
+ * @brief Resets games [first, first + count) with the given seeds.
+ * @return true on success.
+ */
+bool remoteReset(RemoteClient *client, int first, int count,
+                 const uint64_t *seeds);
+
+/**
+ * @brief Steps games [first, first + count) and decodes their observations.
+ * @param client    The client.
+ * @param first     First game.
+ * @param count     Number of games.
+ * @param actions   One action per game.
+ * @param frameSkip Ticks per action (0 counts as 1).
+ * @param events    Optional: receives the SI_EVENT_* mask of each game.
+ * @return true on success.
+ */
+bool remoteStep(RemoteClient *client, int first, int count,
+                const SiAction *actions, unsigned frameSkip,
+                uint32_t *events);
+
+#endif // REMOTE_CONTROLLER_H
@@ -0,0 +1,59 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/**
+ * @file rng.h
+ * @brief Small, fast, explicitly seeded pseudo-random number generator.
+ *
+ * Replaces the global libc `rand()` inside the Model. Every generator is a
+ * plain value (no hidden global state), so each World/Swarm owns its own
+ * stream: simulations are reproducible from their seed and independent
+ * worlds can be stepped on different threads without locking.
+ *
+ * Algorithm: xorshift64* for the stream, SplitMix64 to expand the seed
+ * (so that any seed, including 0, yields a well-mixed non-zero state).
+ */
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/**
+ * @brief State of one random stream.
+ */
+typedef struct {
+  uint64_t state; /**< Internal xorshift state. Never 0 once seeded. */
+} Rng;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief (Re)starts a stream from a seed.
+ * The same seed always produces the same sequence.
+ * @param rng  Pointer to the generator.
+ * @param seed Any 64-bit value.
+ */
+void seedRng(Rng *rng, uint64_t seed);
+
+/**
+ * @brief Returns the next 64-bit value of the stream.
+ * @param rng Pointer to the generator.
+ * @return uint64_t Uniformly distributed value.
+ */
+uint64_t nextRng(Rng *rng);
+
+/**
+ * @brief Returns a value in the range [0, bound).
+ * Uses multiply-shift reduction (no modulo bias worth mentioning for small
+ * bounds, and no division).
+ * @param rng   Pointer to the generator.
+ * @param bound Exclusive upper limit (must be > 0).
+ * @return unsigned Value between 0 and bound - 1.
+ */
+unsigned rngRange(Rng *rng, unsigned bound);
+
+#endif // RNG_H
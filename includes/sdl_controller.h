@@ -5,6 +5,7 @@
 #include "player.h"
 #include "projectile.h"
 #include "sdl_view.h"
+#include "sim_clock.h"
 #include <stdbool.h>
 
 /**
@@ -28,6 +29,8 @@
  * - **State Management:** Toggling between Menu, Playing, Paused, and Game
  * Over.
  * - **View Actions:** Toggling fullscreen mode.
+ * - **Time Scale:** '[' halves and ']' doubles the speed of the simulation
+ * (slow motion / fast forward), '0' restores real time, 'T' toggles turbo.
  * * It supports both Keyboard and Gamepad (Controller) input.
  * * @param player      Pointer to the player object to update based on input.
  * @param projectiles Pointer to the projectile pool (to spawn bullets on
@@ -36,11 +39,13 @@
  * management).
  * @param gameState   Pointer to the current game state (allows transitions like
  * Pause/Resume).
+ * @param clock       Pointer to the simulation clock (time scale keys).
+ * @param now         Clock of the World (weapon cooldown).
  * * @return true  If the game loop should continue running.
  * @return false If the user requested to Quit the application (ESC or Close
  * Window).
  */
 bool handleInput(Player *player, Projectiles *projectiles, SDL_Context *view,
-                 GameState *gameState);
+                 GameState *gameState, SimClock *clock, TimerTime now);
 
 #endif // CONTROLLER_H
\ No newline at end of file
@@ -61,7 +61,6 @@ typedef struct {
   SDL_Texture *enemyTexture2; /**< Frame 2 of Enemy animation. */
   SDL_Texture *playerProjectileTexture;
   SDL_Texture *enemyProjectileTexture;
-  SDL_Texture *bunkerTexture;
   SDL_Texture *bossTexture;
 
   /** @brief Array of frames for the explosion animation. */
@@ -73,6 +72,19 @@ typedef struct {
   /** @brief Array of frames for enemy exhaust/effects (if used). */
   SDL_Texture *exhaustTexture[4];
 
+  // --- Bunkers (one streaming texture per bunker) ---
+  /** @brief Damage bitmaps in RGBA; eroded pixels are transparent. */
+  SDL_Texture *bunkerTextures[BUNKER_COUNT];
+
+  /** @brief bunker.png sampled once per block pixel (RGBA32 texels). */
+  Uint32 bunkerTile[BLOCK_PIXELS * BLOCK_PIXELS];
+
+  /**
+   * @brief Bitmaps as last uploaded: only the rectangle that differs from
+   * the model is sent again (SDL_UpdateTexture) after an impact.
+   */
+  BunkerRow bunkerShadow[BUNKER_COUNT][BUNKER_PIXEL_HEIGHT][BUNKER_ROW_WORDS];
+
   // --- Typography ---
   TTF_Font *font; /**< Main font used for Score and Game Over text. */
 
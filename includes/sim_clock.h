@@ -0,0 +1,97 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdbool.h>
+
+/**
+ * @file sim_clock.h
+ * @brief Fixed-rate simulation clock (accumulator) for the interactive
+ * loops.
+ *
+ * The model always advances by the same step (1 / hz seconds), whatever the
+ * frame rate: each frame adds the real time elapsed (times the time scale)
+ * to an accumulator, and the loop runs one step per whole step held. The
+ * fraction left over tells the View how far it is between the last two
+ * steps (interpolateWorld()).
+ *
+ * A frame never runs more than `maxSteps` steps: after a hitch (window
+ * dragged, debugger, slow disk) the backlog beyond that budget is dropped
+ * instead of being simulated in one burst, so the game slows down for a
+ * moment but never takes a huge step nor falls further and further behind.
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Default simulation rate (steps per second). */
+#define SIM_DEFAULT_HZ 60
+
+/** @brief Accepted simulation rates. */
+#define SIM_MIN_HZ 10
+#define SIM_MAX_HZ 1000
+
+/** @brief Default catch-up budget, in seconds of simulated time per frame. */
+#define SIM_CATCH_UP_SECONDS 0.25
+
+/** @brief Slowest and fastest time scales (slow motion / fast forward). */
+#define SIM_MIN_TIME_SCALE 0.125
+#define SIM_MAX_TIME_SCALE 8.0
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief State of the clock (owned by the loop). */
+typedef struct {
+  double stepSeconds; /**< Fixed step: 1 / hz. */
+  double accumulator; /**< Scaled time not simulated yet (< stepSeconds). */
+  double timeScale;   /**< Simulated seconds per real second. */
+  int maxSteps;       /**< Catch-up budget: most steps run by one frame. */
+  bool turbo;         /**< Ignore real time: run maxSteps every frame. */
+  unsigned long long steps; /**< Steps handed out so far. */
+  double droppedSeconds;    /**< Scaled time dropped by the budget. */
+} SimClock;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Sets up a clock at `hz` steps per second, real time (scale 1).
+ * @param clock    The clock.
+ * @param hz       Simulation rate, clamped to [SIM_MIN_HZ, SIM_MAX_HZ].
+ * @param maxSteps Catch-up budget (0: SIM_CATCH_UP_SECONDS worth of steps).
+ */
+void initSimClock(SimClock *clock, double hz, int maxSteps);
+
+/**
+ * @brief Adds one frame of real time and tells how many steps to run.
+ * @param clock       The clock.
+ * @param realSeconds Real time since the previous frame (>= 0).
+ * @return int Steps of getSimStep() seconds to run now (<= maxSteps).
+ */
+int advanceSimClock(SimClock *clock, double realSeconds);
+
+/**
+ * @brief Forgets the time not simulated yet (e.g., while paused, so that
+ * resuming does not catch up on the pause).
+ */
+void resetSimClock(SimClock *clock);
+
+/** @brief The fixed step, in seconds (what the model is given). */
+float getSimStep(const SimClock *clock);
+
+/**
+ * @brief How far the clock is between the last step and the next one, in
+ * [0, 1]: the interpolation factor for rendering.
+ */
+float getSimAlpha(const SimClock *clock);
+
+/** @brief Sets the time scale, clamped to the accepted range. */
+void setSimTimeScale(SimClock *clock, double scale);
+
+/** @brief Switches turbo (run the whole budget every frame) on or off. */
+void setSimTurbo(SimClock *clock, bool turbo);
+
+#endif // SIM_CLOCK_H
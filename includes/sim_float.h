@@ -0,0 +1,52 @@
+#ifndef SIM_FLOAT_H
+#define SIM_FLOAT_H
+
+#include <float.h>
+
+/**
+ * @file sim_float.h
+ * @brief Float rules of the simulation, enforced in the source.
+ *
+ * Positions and speeds are fixed-point integers (fixed_point.h); what
+ * floats remain in the Model are the conversions at its edges: the
+ * duration of a step to a Fixed and to clock ticks, the swarm's intervals
+ * in seconds to ticks. They only use IEEE-754 single-precision
+ * multiplications, additions and compares (no libm), each rounded on its
+ * own, so that they too are bit-exact across builds. Two things would
+ * break that, and neither depends on the build flags once this header is
+ * included:
+ *
+ * - Contraction: `seconds * rate + 0.5f` fused into one FMA rounds once
+ *   instead of twice. GCC contracts by default wherever the target has FMA
+ *   (-march=native, -mfma), clang within an expression. The Makefile
+ *   turns it off with -ffp-contract=off (FP_CFLAGS), kept out of CFLAGS so
+ *   that no override drops it. The pragmas below are a second guard for
+ *   builds that do not go through the Makefile.
+ * - Wider or looser arithmetic: x87 excess precision (-mfpmath=387) or
+ *   -ffast-math. These cannot be undone by a pragma, so the build fails.
+ *
+ * Only the sources of src/model/ include this file, first, so that its
+ * pragmas cover the whole translation unit and nothing else. No header
+ * does: the Controllers, the Views and the callers of the public API are
+ * compiled as their own flags say.
+ */
+
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+/*
+ * FLT_EVAL_METHOD 0: every operation is evaluated in its own type.
+ * FLT_EVAL_METHOD 16 (ISO/IEC TS 18661-3, C23; GCC with AVX512-FP16):
+ * types no wider than _Float16 are evaluated as _Float16, and every wider
+ * type in itself. float and double are therefore evaluated exactly as with
+ * 0, and the model has no _Float16. Any other value (1, 2, -1) widens
+ * float operations.
+ */
+#if (FLT_EVAL_METHOD != 0 && FLT_EVAL_METHOD != 16) || defined(__FAST_MATH__)
+#error "the model needs single-precision float math (SSE, no -ffast-math)"
+#endif
+
+#endif // SIM_FLOAT_H
@@ -0,0 +1,200 @@
+#ifndef SPACEINVADERS_CORE_H
+#define SPACEINVADERS_CORE_H
+
+#include <stdint.h>
+
+/**
+ * @file spaceinvaders_core.h
+ * @brief Stable C interface of libspaceinvaders_core (.so / .a).
+ *
+ * The core library contains the simulation only (src/model): it does not
+ * link SDL, SDL_image, SDL_ttf, SDL_mixer or ncurses. This header is self
+ * contained and only uses fixed-width types, so it can be bound from any
+ * language (ctypes, cffi, Rust FFI...) without the internal Model headers.
+ *
+ * Compatibility rules: functions are only added, never changed. Structures
+ * are only extended through a new SI_API_VERSION.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__)
+#define SI_API __attribute__((visibility("default")))
+#else
+#define SI_API
+#endif
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Version of the structures below. */
+#define SI_API_VERSION 1u
+
+/** @brief Duration of one siStep() tick in seconds (60 Hz). */
+#define SI_TICK_SECONDS (1.0f / 60.0f)
+
+/** @brief Play field used by the game runners (siCreate() arguments). */
+#define SI_SCREEN_WIDTH 800
+#define SI_SCREEN_HEIGHT 600
+
+/** @brief Number of enemy slots in an observation (11 x 5 grid). */
+#define SI_MAX_ENEMIES 55
+
+/** @brief Number of bullet slots in an observation. */
+#define SI_MAX_BULLETS 20
+
+/** @brief Horizontal input of one step. */
+enum {
+  SI_MOVE_NONE = 0,
+  SI_MOVE_LEFT = 1,
+  SI_MOVE_RIGHT = 2
+};
+
+/** @brief Game status reported in SiObservation.status. */
+enum {
+  SI_STATUS_PLAYING = 0,
+  SI_STATUS_LOST = 1,
+  SI_STATUS_WON = 2
+};
+
+/** @brief Bit flags returned by siStep(). */
+enum {
+  SI_EVENT_ENEMY_SHOOT = 1u << 0,  /**< An enemy (or the Boss) fired. */
+  SI_EVENT_ENEMY_HIT = 1u << 1,    /**< At least one enemy was destroyed. */
+  SI_EVENT_PLAYER_DIED = 1u << 2,  /**< The player lost its last life. */
+  SI_EVENT_LEVEL_CHANGE = 1u << 3, /**< The next level was loaded. */
+  SI_EVENT_GAME_WON = 1u << 4      /**< The last level was cleared. */
+};
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief Opaque game instance. */
+typedef struct SiEnv SiEnv;
+
+/** @brief Opaque pixel renderer (one output size and format). */
+typedef struct SiRenderer SiRenderer;
+
+/** @brief Input of one step. */
+typedef struct {
+  int32_t move; /**< SI_MOVE_NONE, SI_MOVE_LEFT or SI_MOVE_RIGHT. */
+  int32_t fire; /**< Non-zero to attempt a shot. */
+} SiAction;
+
+/** @brief Everything an agent can see of the game. */
+typedef struct {
+  uint64_t frame;  /**< Ticks since the last reset. */
+  int32_t status;  /**< SI_STATUS_*. */
+  int32_t level;   /**< 1 = Swarm, 2 = Boss. */
+  uint32_t score;  /**< Score of the current game. */
+  uint32_t health; /**< Remaining lives. */
+
+  float playerX; /**< Top-left corner of the ship. */
+  float playerY;
+  float playerWidth;
+  float playerHeight;
+
+  int32_t bossActive; /**< Non-zero on level 2 while the Boss lives. */
+  int32_t bossHealth;
+  float bossX;
+  float bossY;
+
+  uint8_t enemyAlive[SI_MAX_ENEMIES]; /**< Row-major grid, top row first. */
+  float enemyX[SI_MAX_ENEMIES];
+  float enemyY[SI_MAX_ENEMIES];
+
+  uint8_t bulletActive[SI_MAX_BULLETS];
+  float bulletX[SI_MAX_BULLETS];
+  float bulletY[SI_MAX_BULLETS];
+  float bulletVelocityY[SI_MAX_BULLETS]; /**< < 0: player, > 0: enemy. */
+} SiObservation;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Returns SI_API_VERSION of the loaded library.
+ * Bindings should refuse to run if it differs from the header they use.
+ */
+SI_API uint32_t siApiVersion(void);
+
+/**
+ * @brief Creates a game, ready to be stepped.
+ * @param screenWidth  Logical width of the play field (e.g., 800).
+ * @param screenHeight Logical height of the play field (e.g., 600).
+ * @param level        Starting level (1 or 2).
+ * @param seed         Seed of the random stream.
+ * @return SiEnv* The new game, or NULL on invalid arguments / no memory.
+ */
+SI_API SiEnv *siCreate(uint32_t screenWidth, uint32_t screenHeight,
+                       int32_t level, uint64_t seed);
+
+/**
+ * @brief Starts a new game with a new random stream.
+ * Two environments reset with the same seed play exactly the same game for
+ * the same actions.
+ * @param env  The game.
+ * @param seed Seed of the random stream.
+ */
+SI_API void siReset(SiEnv *env, uint64_t seed);
+
+/**
+ * @brief Advances the game by SI_TICK_SECONDS.
+ * Does nothing once the game is over (status != SI_STATUS_PLAYING).
+ * @param env    The game.
+ * @param action Input of this tick.
+ * @return uint32_t Bitwise OR of SI_EVENT_*.
+ */
+SI_API uint32_t siStep(SiEnv *env, SiAction action);
+
+/**
+ * @brief Copies the current state of the game.
+ * @param env The game.
+ * @param out Destination observation.
+ */
+SI_API void siObserve(const SiEnv *env, SiObservation *out);
+
+/**
+ * @brief Frees the game.
+ * @param env The game. Safe to pass NULL.
+ */
+SI_API void siDestroy(SiEnv *env);
+
+/**
+ * @brief Creates a CPU renderer for pixel observations (no SDL needed).
+ * @param width        Image width in pixels (e.g., 84).
+ * @param height       Image height in pixels (e.g., 84).
+ * @param channels     1 for grayscale, 3 for RGB.
+ * @param screenWidth  Play field the games were created with.
+ * @param screenHeight Play field the games were created with.
+ * @return SiRenderer* The renderer, or NULL on invalid arguments / no memory.
+ */
+SI_API SiRenderer *siCreateRenderer(uint32_t width, uint32_t height,
+                                    uint32_t channels, uint32_t screenWidth,
+                                    uint32_t screenHeight);
+
+/**
+ * @brief Draws the current state of a game.
+ * @param renderer The renderer.
+ * @param env      The game.
+ * @param pixels   width * height * channels bytes, rows top to bottom.
+ */
+SI_API void siRender(SiRenderer *renderer, const SiEnv *env,
+                     uint8_t *pixels);
+
+/**
+ * @brief Frees the renderer.
+ * @param renderer The renderer. Safe to pass NULL.
+ */
+SI_API void siDestroyRenderer(SiRenderer *renderer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPACEINVADERS_CORE_H
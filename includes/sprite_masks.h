@@ -0,0 +1,48 @@
+#ifndef SPRITE_MASKS_H
+#define SPRITE_MASKS_H
+
+#include <stdint.h>
+
+/**
+ * @file sprite_masks.h
+ * @brief Alpha coverage of the game sprites, pre-downsampled from assets/.
+ *
+ * The data (src/model/sprite_masks.c) is generated offline by
+ * tools/gen_sprite_masks.py, so the simulation never decodes a PNG and
+ * does not depend on SDL_image.
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Side of every mask, in texels (each texel is 0..255 coverage). */
+#define SPRITE_MASK_SIZE 32
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief Sprites available as masks (same order as the generator). */
+typedef enum {
+  SPRITE_PLAYER,        /**< assets/player.png */
+  SPRITE_ALIEN_1,       /**< assets/alien_1.png (arms down) */
+  SPRITE_ALIEN_2,       /**< assets/alien_2.png (arms up) */
+  SPRITE_BOSS,          /**< assets/boss.png */
+  SPRITE_BULLET_PLAYER, /**< assets/bullet_1.png */
+  SPRITE_BULLET_ENEMY,  /**< assets/bullet_2.png */
+  SPRITE_BUNKER,        /**< assets/bunker.png (one bunker block) */
+  SPRITE_EXPLOSION_1,   /**< assets/explosion_1.png */
+  SPRITE_EXPLOSION_2,   /**< assets/explosion_2.png */
+  SPRITE_EXPLOSION_3,   /**< assets/explosion_3.png */
+  SPRITE_COUNT
+} SpriteId;
+
+/**
+ * @brief Row-major coverage of each sprite, stretched over the whole
+ * texture like SDL_RenderTexture() does with a NULL source rectangle.
+ */
+extern const uint8_t spriteMasks[SPRITE_COUNT]
+                                [SPRITE_MASK_SIZE * SPRITE_MASK_SIZE];
+
+#endif // SPRITE_MASKS_H
@@ -0,0 +1,146 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file timer_wheel.h
+ * @brief Simulated time, and a hierarchical timer wheel to schedule
+ * deadlines on it.
+ *
+ * Every timed behaviour of the model (weapon cooldowns, swarm steps,
+ * animation frames, explosions) is an absolute deadline on the simulated
+ * clock of its World, in integer microseconds: nothing is decremented each
+ * step, an object only compares the clock with its deadline, or is told
+ * when it expires.
+ *
+ * A TimerWheel tells. It holds up to `capacity` timers, each identified by
+ * its index, in TIMER_WHEEL_LEVELS rings of TIMER_WHEEL_SLOTS slots: level 0
+ * sorts the next 64 ticks (of about a millisecond) one slot per tick,
+ * level 1 the next 64 x 64 ticks 64 per slot, and so on. A timer
+ * sits in the finest level that covers its deadline, and moves down a
+ * level ("cascades") when the wheel reaches its slot. Scheduling and
+ * cancelling are O(1), and advancing the wheel only visits the slots it
+ * crosses (empty ones are skipped with a bitmap) and the timers that fire
+ * or cascade: its cost does not depend on how many timers are waiting.
+ *
+ * The wheel is deterministic: the same calls fire the same timers in the
+ * same order (slot by slot, most recently scheduled first within a slot).
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief TimerTime units per second (the clock counts microseconds). */
+#define TIMER_TICKS_PER_SECOND 1000000
+
+/** @brief A wheel tick is 2^TIMER_WHEEL_TICK_BITS microseconds (1.024 ms). */
+#define TIMER_WHEEL_TICK_BITS 10
+
+/** @brief Slots per level (one bit each in a 64-bit occupancy mask). */
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief Number of levels. Four levels cover 2^24 ticks (about 4.8 hours);
+ * later deadlines wait in the last level and cascade again until they are
+ * in range.
+ */
+#define TIMER_WHEEL_LEVELS 4
+
+/** @brief Index that means "no timer" (empty slot, end of a list). */
+#define TIMER_NONE UINT32_MAX
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief A point in simulated time, in microseconds. */
+typedef uint64_t TimerTime;
+
+/**
+ * @brief The scheduler: `capacity` timers and the slots they wait in.
+ * Each pending timer is in exactly one slot list (doubly linked through
+ * `next` / `prev`, by index).
+ */
+typedef struct {
+  TimerTime now;     /**< Time the wheel has been advanced to. */
+  uint32_t capacity; /**< Number of timers (ids 0 to capacity - 1). */
+  uint32_t pending;  /**< Timers currently scheduled. */
+
+  /** @brief One bit per non-empty slot, per level. */
+  uint64_t occupied[TIMER_WHEEL_LEVELS];
+  /** @brief First timer of each slot (TIMER_NONE if empty). */
+  uint32_t heads[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS];
+
+  // --- Per timer (capacity entries) ---
+  TimerTime *deadline; /**< When the timer expires. */
+  uint32_t *next;      /**< Next timer in the same slot. */
+  uint32_t *prev;      /**< Previous timer in the same slot. */
+  uint16_t *slot;      /**< Slot holding it, or TIMER_WHEEL_IDLE. */
+} TimerWheel;
+
+/** @brief TimerWheel.slot of a timer that is not scheduled. */
+#define TIMER_WHEEL_IDLE UINT16_MAX
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Converts a duration in seconds to TimerTime, rounded to the
+ * nearest microsecond (negative durations count as 0).
+ */
+static inline TimerTime secondsToTimer(float seconds) {
+  return seconds > 0.0f
+             ? (TimerTime)(seconds * (float)TIMER_TICKS_PER_SECOND + 0.5f)
+             : 0;
+}
+
+/**
+ * @brief Allocates a wheel of `capacity` timers, none scheduled, at time 0.
+ * @param capacity Number of timers (> 0).
+ * @return TimerWheel* The new wheel, or NULL on allocation failure.
+ */
+TimerWheel *createTimerWheel(uint32_t capacity);
+
+/**
+ * @brief Frees the wheel and its arrays.
+ * @param wheel Pointer to the wheel. Safe to pass NULL.
+ */
+void destroyTimerWheel(TimerWheel *wheel);
+
+/**
+ * @brief Schedules timer `id` to fire at `deadline`, replacing its previous
+ * deadline if it was already pending. A deadline that is not after the
+ * wheel's time fires at the next advanceTimerWheel().
+ * @param wheel    Pointer to the wheel.
+ * @param id       Timer index (< capacity).
+ * @param deadline When it must fire.
+ */
+void scheduleTimer(TimerWheel *wheel, uint32_t id, TimerTime deadline);
+
+/**
+ * @brief Removes timer `id` from the wheel (no-op if it is not pending).
+ * @param wheel Pointer to the wheel.
+ * @param id    Timer index (< capacity).
+ */
+void cancelTimer(TimerWheel *wheel, uint32_t id);
+
+/** @brief true if timer `id` is scheduled and has not fired yet. */
+bool isTimerPending(const TimerWheel *wheel, uint32_t id);
+
+/**
+ * @brief Moves the wheel's time forward to `now` and collects the timers
+ * whose deadline is at or before it. A fired timer is no longer pending:
+ * reschedule it to make it periodic.
+ * @param wheel Pointer to the wheel.
+ * @param now   New time (an earlier time only fires the overdue timers).
+ * @param fired [Output] Room for `capacity` ids: the timers that fired.
+ * @return uint32_t Number of ids written to `fired`.
+ */
+uint32_t advanceTimerWheel(TimerWheel *wheel, TimerTime now, uint32_t *fired);
+
+#endif // TIMER_WHEEL_H
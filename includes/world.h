@@ -0,0 +1,235 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "bunker.h"
+#include "enemy.h"
+#include "explosion.h"
+#include "game_state.h"
+#include "player.h"
+#include "projectile.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file world.h
+ * @brief Aggregates every Model object of one game into a single "World".
+ *
+ * A World embeds (by value) the Player, Swarm, Projectiles, Explosions and
+ * Bunkers plus the level progression state. It is one contiguous,
+ * pointer-free block of memory: it can be stepped without any View or
+ * Controller attached (headless simulation, bots, benchmarks), and it can
+ * be saved/restored with a plain memcpy (see worldSnapshot()).
+ *
+ * Stepping is deterministic and bit-exact across builds: positions, sizes
+ * and speeds are 16.16 fixed-point integers (fixed_point.h), so moves and
+ * collision tests are integer operations with one defined rounding. The
+ * duration of a step enters as a float and is converted once per step;
+ * that conversion and the few other float operations left follow the
+ * rules of sim_float.h.
+ *
+ * Time is an integer: the World's clock counts microseconds of play
+ * (TimerTime), and every cooldown or animation is a deadline on it (see
+ * timer_wheel.h). Nothing counts down from step to step; an entity compares
+ * the clock with its deadline, and a WorldBatch schedules the deadlines of
+ * all its games on one timer wheel.
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Player sprite height used by the runners (hitbox). */
+#define WORLD_PLAYER_HEIGHT 30
+
+/** @brief Player sprite width used by the runners (hitbox). */
+#define WORLD_PLAYER_WIDTH 50
+
+/** @brief Identifies a WorldSnapshot buffer ("SINV" in ASCII). */
+#define WORLD_SNAPSHOT_MAGIC 0x564E4953u
+
+/**
+ * @brief Layout version of WorldSnapshot.
+ * Bump it whenever a Model structure embedded in World changes meaning.
+ */
+#define WORLD_SNAPSHOT_VERSION 14u
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/**
+ * @brief The input of one simulation step.
+ * Abstract equivalent of what the keyboard controllers produce.
+ */
+typedef struct {
+  Direction move; /**< MOVE_LEFT, MOVE_RIGHT or MOVE_NONE. */
+  bool fire;      /**< true to attempt a shot this step. */
+} WorldAction;
+
+/**
+ * @brief Things that happened during one updateWorld() call.
+ * Bit flags, used by the runners to trigger sounds and save the high score.
+ */
+typedef enum {
+  WORLD_EVENT_NONE = 0,
+  WORLD_EVENT_ENEMY_SHOOT = 1 << 0,  /**< An enemy (or the Boss) fired. */
+  WORLD_EVENT_ENEMY_HIT = 1 << 1,    /**< At least one enemy was destroyed. */
+  WORLD_EVENT_PLAYER_DIED = 1 << 2,  /**< The player lost its last life. */
+  WORLD_EVENT_LEVEL_CHANGE = 1 << 3, /**< The next level was loaded. */
+  WORLD_EVENT_GAME_WON = 1 << 4      /**< The last level was cleared. */
+} WorldEvent;
+
+/**
+ * @brief One complete, independent game instance.
+ * Contains no pointers: copying the struct copies the whole game.
+ */
+typedef struct {
+  Player player;               /**< The player ship. */
+  Swarm swarm;                 /**< Enemies (or Boss) of the current level. */
+  Projectiles projectiles;     /**< Bullet pool (player + enemies). */
+  ExplosionManager explosions; /**< Visual effects pool. */
+  BunkerManager bunkers;       /**< Destructible shields. */
+
+  unsigned screenWidth;  /**< Logical width of the play field. */
+  unsigned screenHeight; /**< Logical height of the play field. */
+
+  /** @brief Time played since initWorld(): the sum of the ticks' durations. */
+  TimerTime clock;
+
+  int startLevel;   /**< Level used by resetWorld(). */
+  int currentLevel; /**< Level currently being played. */
+  GameState state;  /**< Menu / Playing / Paused / Game Over. */
+  bool playerWon;   /**< Outcome once state is STATE_GAME_OVER. */
+} World;
+
+/**
+ * @brief A versioned, self-describing copy of a World.
+ * The header lets worldRestore() reject buffers coming from another build
+ * (different version or different World layout).
+ */
+typedef struct {
+  uint32_t magic;    /**< WORLD_SNAPSHOT_MAGIC. */
+  uint32_t version;  /**< WORLD_SNAPSHOT_VERSION. */
+  uint32_t size;     /**< sizeof(World) of the build that wrote it. */
+  uint32_t reserved; /**< Always 0. */
+  World world;       /**< The captured game state. */
+} WorldSnapshot;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Allocates a World (one single block) ready to be stepped.
+ * The World starts directly in STATE_PLAYING (there is no menu).
+ *
+ * @param screenWidth  Logical width of the play field (e.g., 800).
+ * @param screenHeight Logical height of the play field (e.g., 600).
+ * @param level        Starting level (1 = Swarm, 2 = Boss).
+ * @param seed         Seed of the World's random stream (see seedWorld()).
+ * @return World* Pointer to the new World, or NULL on failure.
+ */
+World *createWorld(unsigned screenWidth, unsigned screenHeight, int level,
+                   uint64_t seed);
+
+/**
+ * @brief Initializes an already allocated World (same as createWorld()).
+ * @param world        Pointer to the World.
+ * @param screenWidth  Logical width of the play field.
+ * @param screenHeight Logical height of the play field.
+ * @param level        Starting level (1 = Swarm, 2 = Boss).
+ * @param seed         Seed of the World's random stream.
+ */
+void initWorld(World *world, unsigned screenWidth, unsigned screenHeight,
+               int level, uint64_t seed);
+
+/**
+ * @brief Restarts the World's random stream.
+ * The stream lives in the current Swarm and is carried over to the next
+ * Swarm on level changes and resets, so a whole session (several games) is
+ * reproducible from one seed, and worlds never share random state.
+ * @param world Pointer to the World.
+ * @param seed  Any 64-bit value.
+ */
+void seedWorld(World *world, uint64_t seed);
+
+/**
+ * @brief Frees the World.
+ * @param world Pointer to the World to free. Safe to pass NULL.
+ */
+void destroyWorld(World *world);
+
+/**
+ * @brief Starts a new game at `world->startLevel`, in STATE_PLAYING.
+ * Player health and score are restored, the swarm, bullets and explosions
+ * are reinitialized and the bunkers are rebuilt. The high score and the
+ * random stream are kept (the next game continues the sequence).
+ *
+ * @param world Pointer to the World.
+ */
+void resetWorld(World *world);
+
+/**
+ * @brief Advances the simulation by one tick, without touching the input.
+ *
+ * Moves the clock forward by `deltaTime`, then runs the update sequence of
+ * the game: updatePlayer -> updateProjectiles -> updateSwarm ->
+ * updateExplosions -> enemyAttemptShoot -> checkCollisions -> level
+ * progression.
+ * Does nothing unless the World is in STATE_PLAYING.
+ *
+ * @param world     Pointer to the World.
+ * @param deltaTime Duration of the tick in seconds (moves use it as a
+ * Fixed, rounded towards zero: 1/60 s is 1092/65536).
+ * @return unsigned Bitwise OR of the WorldEvent that occurred.
+ */
+unsigned updateWorld(World *world, float deltaTime);
+
+/**
+ * @brief Applies an action (move + fire) then calls updateWorld().
+ * This is the entry point for headless simulation and bots.
+ *
+ * @param world     Pointer to the World.
+ * @param action    Player input for this tick.
+ * @param deltaTime Duration of the tick in seconds.
+ * @return unsigned Bitwise OR of the WorldEvent that occurred.
+ */
+unsigned stepWorld(World *world, WorldAction action, float deltaTime);
+
+/**
+ * @brief Builds the World to draw between two steps (fixed-timestep
+ * loops, see sim_clock.h).
+ * `out` is a copy of `current` in which the entities that move smoothly
+ * (player, boss, bullets) are placed `alpha` of the way from their
+ * position in `previous`. The swarm moves in whole ticks and is not
+ * interpolated. If the level or the state changed between the two steps,
+ * `current` is drawn as is.
+ *
+ * @param out      Receives the World to render (never stepped).
+ * @param previous The World before the last step (may be NULL).
+ * @param current  The World after the last step.
+ * @param alpha    getSimAlpha(), in [0, 1].
+ */
+void interpolateWorld(World *out, const World *previous, const World *current,
+                      float alpha);
+
+/**
+ * @brief Captures the complete game state into a flat buffer.
+ * The snapshot contains no pointers: it can be stored, sent over the
+ * network or duplicated with memcpy.
+ * @param world    Pointer to the World to capture.
+ * @param snapshot Pointer to the destination buffer.
+ */
+void worldSnapshot(const World *world, WorldSnapshot *snapshot);
+
+/**
+ * @brief Restores a World from a snapshot with a single memcpy.
+ * @param world    Pointer to the World to overwrite.
+ * @param snapshot Pointer to a buffer filled by worldSnapshot().
+ * @return true  If the snapshot was restored.
+ * @return false If the buffer is not a snapshot of this build (bad magic,
+ * version or size). The World is left untouched.
+ */
+bool worldRestore(World *world, const WorldSnapshot *snapshot);
+
+#endif // WORLD_H
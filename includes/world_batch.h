@@ -0,0 +1,193 @@
+#ifndef WORLD_BATCH_H
+#define WORLD_BATCH_H
+
+#include "bunker.h"
+#include "enemy.h"
+#include "explosion.h"
+#include "rng.h"
+#include "timer_wheel.h"
+#include "world.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file world_batch.h
+ * @brief Steps N independent games in one call (vectorized environment).
+ *
+ * Stepping thousands of World structs one by one wastes most of the time in
+ * cache misses: each World is a 6 KB block and every update touches a few
+ * bytes in each. A WorldBatch stores the same games in Structure-of-Arrays
+ * form instead: all N player X values are contiguous, all N x 55 enemy X
+ * values are contiguous, and so on. Each update phase becomes a straight
+ * loop over the batch that the compiler can auto-vectorize.
+ *
+ * The rules are exactly those of stepWorld(): a game stepped inside a batch
+ * evolves like the same game stepped as a World. Rarely touched state
+ * (bunkers, explosions) stays in its regular Model struct, one per game.
+ * Collisions go through the same findImpacts() as a World (physics.h),
+ * so `spaceinvaders batch` compares the two layouts alone. They are most
+ * of a step, which leaves the layout a small gain.
+ *
+ * Timed behaviours (exhaust animation, swarm steps and shots, explosion
+ * frames) are not polled game by game: the deadlines of every game are
+ * scheduled on one TimerWheel, and a step only visits the games whose
+ * timers expire. The weapon cooldown is a plain deadline, checked when the
+ * player fires.
+ */
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/**
+ * @brief N games in Structure-of-Arrays layout.
+ * Per-game arrays have `count` entries; bullet arrays have
+ * `count * MAX_PROJECTILES` entries and enemy arrays `count * TOTAL_ENEMIES`
+ * (game `i` owns the slice starting at `i * MAX_PROJECTILES` /
+ * `i * TOTAL_ENEMIES`).
+ */
+typedef struct {
+  int count;             /**< Number of games in the batch. */
+  unsigned screenWidth;  /**< Logical width shared by all games. */
+  unsigned screenHeight; /**< Logical height shared by all games. */
+  int startLevel;        /**< Level used when a game is reset. */
+
+  // --- Progress (per game) ---
+  int *currentLevel;
+  GameState *state;
+  bool *playerWon;
+  TimerTime *clock; /**< World.clock: advances while the game is playing. */
+
+  // --- Player (per game) ---
+  Fixed *playerX;
+  Fixed *playerY;
+  Fixed *playerVelocityX;
+  TimerTime *playerShootReadyAt;
+  TimerTime *playerAnimAt;
+  int *playerAnimFrame;
+  int *playerAnimDir;
+  unsigned *playerWidth;
+  unsigned *playerHeight;
+  unsigned *playerHealth;
+  unsigned *playerScore;
+  unsigned *playerHighScore;
+
+  // --- Projectiles (per game) ---
+  unsigned *bulletCount;    /**< Live bullets: slots [0, bulletCount). */
+  unsigned *bulletCapacity; /**< Usable slots (Projectiles capacity). */
+
+  // --- Projectiles (count * MAX_PROJECTILES, densely packed) ---
+  Fixed *bulletX;
+  Fixed *bulletY;
+  Fixed *bulletVelocityX;
+  Fixed *bulletVelocityY;
+  Fixed *bulletPrevX;
+  Fixed *bulletPrevY;
+
+  // --- Enemy grid (count * TOTAL_ENEMIES) ---
+  // Positions are swarmOrigin + slot offset (see ENEMY_PITCH_X / _Y)
+  bool *enemyActive;
+
+  // --- Swarm (per game) ---
+  int *swarmLevel;
+  SwarmKind *swarmKind;
+  int *swarmDirection;
+  TimerTime *swarmLastMoveAt;
+  TimerTime *swarmMoveInterval;
+  TimerTime *swarmShootAt;
+  TimerTime *swarmShootCooldown;
+  unsigned *swarmAliveCount;
+  SwarmAlive *swarmAlive;
+  Fixed *swarmOriginX;
+  Fixed *swarmOriginY;
+  bool *swarmAnimationFrame;
+  Rng *swarmRng;
+
+  // --- Boss (per game) ---
+  bool *bossActive;
+  Fixed *bossX;
+  Fixed *bossY;
+  Fixed *bossWidth;
+  Fixed *bossHeight;
+  int *bossHealth;
+  int *bossMaxHealth;
+  int *bossDirection;
+
+  // --- Cold state (one Model struct per game) ---
+  ExplosionManager *explosions;
+  BunkerManager *bunkers;
+
+  // --- Scheduler ---
+  /**
+   * @brief Pending deadlines of the playing games, on a time base of its
+   * own (a game's deadline D is due when the wheel reaches
+   * `wheel time + D - clock[i]`). A game that stops playing has none.
+   */
+  TimerWheel *timers;
+  uint32_t *firedTimers; /**< Scratch: timers fired by the current step. */
+  bool *playing;         /**< Scratch: games playing at the current step. */
+  unsigned *stepEvents;  /**< Scratch: events, when the caller wants none. */
+} WorldBatch;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Allocates a batch of `count` games, each initialized like
+ * createWorld(). Game `i` is seeded with `seed + i`.
+ *
+ * @param count        Number of games (> 0).
+ * @param screenWidth  Logical width of the play field.
+ * @param screenHeight Logical height of the play field.
+ * @param level        Starting level of every game.
+ * @param seed         Base seed of the random streams.
+ * @return WorldBatch* The new batch, or NULL on allocation failure.
+ */
+WorldBatch *createWorldBatch(int count, unsigned screenWidth,
+                             unsigned screenHeight, int level, uint64_t seed);
+
+/**
+ * @brief Frees the batch and all of its arrays.
+ * @param batch Pointer to the batch. Safe to pass NULL.
+ */
+void destroyWorldBatch(WorldBatch *batch);
+
+/**
+ * @brief Copies a regular World into slot `index` of the batch (scatter).
+ * @param batch Pointer to the batch.
+ * @param index Game slot (0 <= index < count).
+ * @param world Source World.
+ */
+void loadBatchWorld(WorldBatch *batch, int index, const World *world);
+
+/**
+ * @brief Rebuilds a regular World from slot `index` of the batch (gather).
+ * Used to render, snapshot or validate one game of the batch.
+ * @param batch Pointer to the batch.
+ * @param index Game slot (0 <= index < count).
+ * @param world Destination World (fully overwritten).
+ */
+void storeBatchWorld(const WorldBatch *batch, int index, World *world);
+
+/**
+ * @brief Starts a new game in slot `index` (same as resetWorld()).
+ * @param batch Pointer to the batch.
+ * @param index Game slot (0 <= index < count).
+ */
+void resetBatchWorld(WorldBatch *batch, int index);
+
+/**
+ * @brief Advances every game of the batch by one tick.
+ * Equivalent to calling stepWorld() on each game, with `actions[i]` as the
+ * input of game `i`. Games that are not in STATE_PLAYING are left as is.
+ *
+ * @param batch     Pointer to the batch.
+ * @param actions   Array of `count` actions.
+ * @param deltaTime Duration of the tick in seconds.
+ * @param events    Optional array of `count` WorldEvent masks (may be NULL).
+ */
+void stepWorldBatch(WorldBatch *batch, const WorldAction *actions,
+                    float deltaTime, unsigned *events);
+
+#endif // WORLD_BATCH_H
@@ -0,0 +1,105 @@
+#ifndef WORLD_FORK_H
+#define WORLD_FORK_H
+
+#include "world.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file world_fork.h
+ * @brief Copy-on-write copies of a World for tree-search workloads.
+ *
+ * Lookahead search branches many child worlds from one parent, and most
+ * children only change a few bullets. A WorldFork therefore splits the
+ * World in two parts:
+ * - The "hot" state (player, bullets, swarm timers, level...) which changes
+ * every tick and is always private to the fork.
+ * - Large "blocks" (enemy grid, bunkers, explosions) which are reference
+ * counted and shared between a parent and its children. A block is only
+ * duplicated when a fork actually writes different content into it.
+ *
+ * A family of forks shares blocks without locking: all forks derived from
+ * the same root must be used from a single thread.
+ */
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/**
+ * @brief Identifiers of the shareable parts of a World.
+ */
+typedef enum {
+  FORK_BLOCK_ENEMIES,    /**< Swarm.enemies (the 55-entry grid). */
+  FORK_BLOCK_BUNKERS,    /**< The whole BunkerManager. */
+  FORK_BLOCK_EXPLOSIONS, /**< The whole ExplosionManager. */
+  FORK_BLOCK_COUNT
+} ForkBlockId;
+
+/** @brief Opaque copy-on-write World (see world_fork.c). */
+typedef struct WorldFork WorldFork;
+
+/**
+ * @brief Memory accounting of one fork.
+ */
+typedef struct {
+  size_t privateBytes;   /**< Hot state + blocks owned by this fork alone. */
+  size_t sharedBytes;    /**< Blocks referenced by this fork and others. */
+  unsigned sharedBlocks; /**< How many of the FORK_BLOCK_COUNT are shared. */
+} WorldForkStats;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Creates the root of a fork tree from a regular World.
+ * The World is copied; it can be destroyed or modified afterwards.
+ * @param world Pointer to the source World.
+ * @return WorldFork* New fork owning private copies of every block, or NULL
+ * on allocation failure.
+ */
+WorldFork *createWorldFork(const World *world);
+
+/**
+ * @brief Branches a child from a parent fork in O(1) memory.
+ * The child copies the hot state and references the parent's blocks.
+ * @param parent Pointer to the fork to branch from.
+ * @return WorldFork* The child, or NULL on allocation failure.
+ */
+WorldFork *forkWorld(const WorldFork *parent);
+
+/**
+ * @brief Releases a fork. Shared blocks are freed with their last owner.
+ * @param fork Pointer to the fork. Safe to pass NULL.
+ */
+void destroyWorldFork(WorldFork *fork);
+
+/**
+ * @brief Rebuilds the full World seen by a fork.
+ * @param fork Pointer to the fork.
+ * @param out  Destination World (fully overwritten).
+ */
+void materializeWorldFork(const WorldFork *fork, World *out);
+
+/**
+ * @brief Advances a fork by one tick (same semantics as stepWorld()).
+ * Blocks whose content did not change stay shared. A changed block is
+ * written in place if this fork is its only owner, copied otherwise.
+ * @param fork      Pointer to the fork.
+ * @param action    Player input for this tick.
+ * @param deltaTime Duration of the tick in seconds.
+ * @return unsigned Bitwise OR of the WorldEvent that occurred, or
+ * WORLD_EVENT_NONE if a block copy could not be allocated (the fork is then
+ * left unchanged).
+ */
+unsigned stepWorldFork(WorldFork *fork, WorldAction action, float deltaTime);
+
+/**
+ * @brief Reports how much memory a fork costs on its own.
+ * @param fork Pointer to the fork.
+ * @return WorldForkStats Private vs shared byte counts.
+ */
+WorldForkStats getWorldForkStats(const WorldFork *fork);
+
+#endif // WORLD_FORK_H
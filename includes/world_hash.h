@@ -0,0 +1,87 @@
+#ifndef WORLD_HASH_H
+#define WORLD_HASH_H
+
+#include "world.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @file world_hash.h
+ * @brief Per-tick hash of a World, and field-level diff of two Worlds.
+ *
+ * Stepping is bit-exact, so two runs that play the same inputs must hash
+ * the same after every tick, whatever the build or the code path (World,
+ * WorldBatch, WorldFork, AABB kernel). The first tick where the hashes
+ * differ is where a change broke the simulation, and printWorldDiff()
+ * tells which fields.
+ *
+ * The hash covers what the game can observe: every field of the player,
+ * the living enemies (enemies[].active and both alive masks), deadlines,
+ * boss and random stream of the swarm, the live bullets, the active
+ * explosions, the bunkers, the clock and the level state. Floats are
+ * hashed by their bits. Dead bullet slots and idle explosions are skipped.
+ *
+ * Only the bunker bitmaps and enemies[].active are hashed incrementally:
+ * each bunker and the swarm keep their own Zobrist hash up to date as
+ * pixels and enemies are destroyed (Bunker.hash, Swarm.enemyHash). Every
+ * other field is rehashed on each tick, one multiplication per word. That
+ * costs about 35-40 ns against a step of about 145 ns (`spaceinvaders
+ * desync` prints both), so hashing every tick slows a run by a quarter.
+ */
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief Parts of a World, hashed separately. */
+typedef enum {
+  WORLD_PART_PLAYER,      /**< The player ship. */
+  WORLD_PART_SWARM,       /**< Enemies, boss, timers and random stream. */
+  WORLD_PART_PROJECTILES, /**< Live bullets. */
+  WORLD_PART_EXPLOSIONS,  /**< Active explosions. */
+  WORLD_PART_BUNKERS,     /**< Bunker positions and bitmaps. */
+  WORLD_PART_LEVEL,       /**< Screen, clock, levels, state and outcome. */
+  WORLD_PART_COUNT
+} WorldPart;
+
+/**
+ * @brief Hash of a whole World and of each of its parts.
+ * Only the total goes through a final mixing step: the parts are meant to
+ * be compared for equality, to tell where two Worlds differ.
+ */
+typedef struct {
+  uint64_t total;                   /**< Combines the parts, in order. */
+  uint64_t parts[WORLD_PART_COUNT]; /**< Indexed by WorldPart. */
+} WorldHash;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Hashes every part of a World.
+ * @param world The World.
+ * @param hash  [Output] The total and per-part hashes.
+ */
+void hashWorldParts(const World *world, WorldHash *hash);
+
+/** @brief The total hash of hashWorldParts(). */
+uint64_t hashWorld(const World *world);
+
+/** @brief Short name of a part (e.g., "projectiles"). */
+const char *getWorldPartName(WorldPart part);
+
+/**
+ * @brief Prints the fields that differ between two Worlds, one per line
+ * (e.g., "projectiles.y[3]: 412.5 (0x43ce4000) != ..."). Floats are
+ * compared by their bits, like the hash. The bunker bitmaps are compared
+ * pixel by pixel, and their hash is checked against hashBunkerPixels().
+ * @param out      Where to print.
+ * @param a        First World.
+ * @param b        Second World.
+ * @param maxLines Most fields printed (the others are only counted).
+ * @return int Number of differing fields (0 if the Worlds play the same).
+ */
+int printWorldDiff(FILE *out, const World *a, const World *b, int maxLines);
+
+#endif // WORLD_HASH_H
@@ -0,0 +1,121 @@
+#ifndef WORLD_POOL_H
+#define WORLD_POOL_H
+
+#include "world.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file world_pool.h
+ * @brief Steps thousands of independent Worlds on all CPU cores.
+ *
+ * The worlds are cut into chunks of WORLD_POOL_CHUNK games. At every step,
+ * each thread receives a contiguous range of chunks in its own deque: it
+ * pops chunks from the back of its deque and, once it is empty, steals
+ * chunks from the front of the other threads' deques. Uneven chunks (a
+ * level change, a game reset) are therefore absorbed by idle threads.
+ *
+ * Each World lives in its own cache-line aligned slot, and the per-thread
+ * deques are padded as well, so two threads never write the same cache line.
+ * Every World is stepped by exactly one thread per step and only depends on
+ * its own random stream: the result does not depend on the thread count.
+ */
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Cache line size used to pad the shared structures. */
+#define WORLD_POOL_CACHE_LINE 64
+
+/** @brief Number of worlds handed out per task (steal granularity). */
+#define WORLD_POOL_CHUNK 16
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/**
+ * @brief Chooses the input of one World for the next step.
+ * Called from worker threads: it must only read `world` and `user`.
+ */
+typedef WorldAction (*WorldPolicy)(const World *world, void *user);
+
+/**
+ * @brief Creation parameters of a WorldPool.
+ */
+typedef struct {
+  int worldCount;        /**< Number of games (> 0). */
+  int threadCount;       /**< Threads, including the caller (>= 1). */
+  bool pinThreads;       /**< Pin worker `i` to CPU `i` (Linux only). */
+  bool autoReset;        /**< Restart a game as soon as it ends. */
+  unsigned screenWidth;  /**< Logical width of every World. */
+  unsigned screenHeight; /**< Logical height of every World. */
+  int level;             /**< Starting level of every World. */
+  uint64_t seed;         /**< World `i` is seeded with `seed + i`. */
+  WorldPolicy policy;    /**< Optional: computes actions inside the workers. */
+  void *policyUser;      /**< Passed back to `policy`. */
+} WorldPoolConfig;
+
+/** @brief Opaque pool of worker threads and worlds (see world_pool.c). */
+typedef struct WorldPool WorldPool;
+
+// ==========================================
+//               FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Allocates the worlds and starts `threadCount - 1` worker threads.
+ * @param config Creation parameters.
+ * @return WorldPool* The new pool, or NULL on failure.
+ */
+WorldPool *createWorldPool(const WorldPoolConfig *config);
+
+/**
+ * @brief Stops the worker threads and frees the worlds.
+ * @param pool Pointer to the pool. Safe to pass NULL.
+ */
+void destroyWorldPool(WorldPool *pool);
+
+/**
+ * @brief Advances every World by one tick (stepWorld()), in parallel.
+ * Each World uses the action returned by the policy if there is one, or
+ * the last action given to setWorldPoolAction() otherwise. Blocks until
+ * all worlds have been stepped.
+ * @param pool      Pointer to the pool.
+ * @param deltaTime Duration of the tick in seconds.
+ */
+void stepWorldPool(WorldPool *pool, float deltaTime);
+
+/**
+ * @brief Sets the input of World `index` for the next steps.
+ * @param pool   Pointer to the pool.
+ * @param index  World index (0 <= index < worldCount).
+ * @param action Player input.
+ */
+void setWorldPoolAction(WorldPool *pool, int index, WorldAction action);
+
+/**
+ * @brief Gives access to World `index` between two steps.
+ * @param pool  Pointer to the pool.
+ * @param index World index (0 <= index < worldCount).
+ * @return World* The World, or NULL if the index is out of range.
+ */
+World *getWorldPoolWorld(WorldPool *pool, int index);
+
+/**
+ * @brief WorldEvent mask produced by World `index` during the last step.
+ * @param pool  Pointer to the pool.
+ * @param index World index (0 <= index < worldCount).
+ * @return unsigned Bitwise OR of WorldEvent.
+ */
+unsigned getWorldPoolEvents(const WorldPool *pool, int index);
+
+/**
+ * @brief Total number of chunks taken from another thread's deque.
+ * @param pool Pointer to the pool.
+ * @return unsigned long long Steal count since the pool was created.
+ */
+unsigned long long getWorldPoolSteals(const WorldPool *pool);
+
+#endif // WORLD_POOL_H
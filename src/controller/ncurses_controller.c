@@ -1,11 +1,21 @@
 #include "../../includes/ncurses_controller.h"
 #include <ncurses.h>
 
-#define NCURSES_SPEED 400.0f // Faster speed for terminal feel
-#define GAME_WIDTH 800
+// A terminal sends no key release, only the key repeats: a movement key
+// holds its direction for this long (real seconds) after its last repeat.
+#define NCURSES_KEY_HOLD 0.1f
 
 bool handleNcursesInput(Player *player, Projectiles *bullets, GameState *state,
-                        bool *needsReset, float deltaTime) {
+                        bool *needsReset, float deltaTime, SimClock *clock,
+                        TimerTime now) {
+  static float moveHold = 0.0f; // Real time left before the ship stops
+
+  moveHold -= deltaTime;
+  if (moveHold <= 0.0f) {
+    moveHold = 0.0f;
+    setPlayerDirection(player, MOVE_NONE);
+  }
+
   int ch = getch();
 
   if (ch == ERR)
@@ -33,28 +43,45 @@ bool handleNcursesInput(Player *player, Projectiles *bullets, GameState *state,
       *state = STATE_PLAYING;
     break;
 
+  // --- TIME SCALE ---
+  case '[':
+    if (clock)
+      setSimTimeScale(clock, clock->timeScale / 2.0);
+    break;
+  case ']':
+    if (clock)
+      setSimTimeScale(clock, clock->timeScale * 2.0);
+    break;
+  case '0':
+    if (clock)
+      setSimTimeScale(clock, 1.0);
+    break;
+  case 't':
+    if (clock)
+      setSimTurbo(clock, !clock->turbo);
+    break;
+
   // --- GAMEPLAY (Only works if Playing) ---
   case ' ':
     if (*state == STATE_PLAYING) {
-      playerShoot(player, bullets);
+      playerShoot(player, bullets, now);
     }
     break;
 
+  // The ship moves on the simulation steps (updatePlayer()), like in SDL
   case 'a':
   case KEY_LEFT:
     if (*state == STATE_PLAYING) {
-      player->x -= NCURSES_SPEED * deltaTime;
-      if (player->x < 0)
-        player->x = 0;
+      setPlayerDirection(player, MOVE_LEFT);
+      moveHold = NCURSES_KEY_HOLD;
     }
     break;
 
   case 'd':
   case KEY_RIGHT:
     if (*state == STATE_PLAYING) {
-      player->x += NCURSES_SPEED * deltaTime;
-      if (player->x > GAME_WIDTH - player->width)
-        player->x = GAME_WIDTH - player->width;
+      setPlayerDirection(player, MOVE_RIGHT);
+      moveHold = NCURSES_KEY_HOLD;
     }
     break;
   }
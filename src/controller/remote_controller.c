@@ -0,0 +1,434 @@
+#include "../../includes/remote_controller.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+_Static_assert(sizeof(RemoteHeader) == 16, "RemoteHeader is 16 bytes");
+_Static_assert(sizeof(SiObservation) % 4 == 0,
+               "Observations are diffed as 32-bit words");
+
+/** @brief Size of an observation in 32-bit words. */
+#define OBS_WORDS (sizeof(SiObservation) / 4)
+
+/**
+ * @brief Unchanged words tolerated inside one segment.
+ * A new segment costs one word of header: bridging a gap of 1 word is free.
+ */
+#define SEGMENT_GAP 1
+
+/** @brief Worst-case encoded size of one observation. */
+#define MAX_DELTA_SIZE (8 + OBS_WORDS * 8)
+
+// ==========================================
+//               I/O HELPERS
+// ==========================================
+
+/** @brief Reads exactly `size` bytes. @return false on EOF or error. */
+static bool readAll(int fd, void *buffer, size_t size) {
+  unsigned char *p = (unsigned char *)buffer;
+  while (size > 0) {
+    ssize_t n = read(fd, p, size);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    size -= (size_t)n;
+  }
+  return true;
+}
+
+/** @brief Writes exactly `size` bytes. @return false on error. */
+static bool writeAll(int fd, const void *buffer, size_t size) {
+  const unsigned char *p = (const unsigned char *)buffer;
+  while (size > 0) {
+    ssize_t n = write(fd, p, size);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    size -= (size_t)n;
+  }
+  return true;
+}
+
+// ==========================================
+//               DELTA ENCODING
+// ==========================================
+
+/**
+ * @brief Appends the delta from `*previous` to `*current`, then updates
+ * `*previous`.
+ * @return size_t Bytes written at `out`.
+ */
+static size_t encodeDelta(unsigned char *out, SiObservation *previous,
+                          const SiObservation *current, uint32_t events) {
+  uint32_t before[OBS_WORDS], now[OBS_WORDS];
+  memcpy(before, previous, sizeof(before));
+  memcpy(now, current, sizeof(now));
+
+  memcpy(out, &events, 4);
+  uint16_t segments = 0;
+  size_t size = 8;
+
+  size_t i = 0;
+  while (i < OBS_WORDS) {
+    if (before[i] == now[i]) {
+      i++;
+      continue;
+    }
+
+    // Extend the segment while the gaps stay small
+    size_t start = i, end = i + 1;
+    for (size_t j = end; j < OBS_WORDS && j <= end + SEGMENT_GAP; j++) {
+      if (before[j] != now[j])
+        end = j + 1;
+    }
+
+    uint16_t header[2] = {(uint16_t)start, (uint16_t)(end - start)};
+    memcpy(out + size, header, 4);
+    memcpy(out + size + 4, &now[start], (end - start) * 4);
+    size += 4 + (end - start) * 4;
+    segments++;
+    i = end;
+  }
+
+  uint16_t counts[2] = {segments, 0};
+  memcpy(out + 4, counts, 4);
+  *previous = *current;
+  return size;
+}
+
+/**
+ * @brief Applies one encoded observation to `*observation`.
+ * @return size_t Bytes consumed, or 0 if the data is malformed.
+ */
+static size_t decodeDelta(const unsigned char *in, size_t available,
+                          SiObservation *observation, uint32_t *events) {
+  if (available < 8)
+    return 0;
+
+  uint16_t counts[2];
+  memcpy(events, in, 4);
+  memcpy(counts, in + 4, 4);
+
+  unsigned char *target = (unsigned char *)observation;
+  size_t size = 8;
+  for (uint16_t s = 0; s < counts[0]; s++) {
+    uint16_t header[2];
+    if (size + 4 > available)
+      return 0;
+    memcpy(header, in + size, 4);
+
+    size_t bytes = (size_t)header[1] * 4;
+    if ((size_t)header[0] + header[1] > OBS_WORDS ||
+        size + 4 + bytes > available)
+      return 0;
+    memcpy(target + (size_t)header[0] * 4, in + size + 4, bytes);
+    size += 4 + bytes;
+  }
+  return size;
+}
+
+// ==========================================
+//               SERVER
+// ==========================================
+
+int openRemoteSocket(const char *path) {
+  struct sockaddr_un address;
+  if (!path || strlen(path) >= sizeof(address.sun_path))
+    return -1;
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    return -1;
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, path);
+  unlink(path);
+
+  if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+      listen(fd, 1) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/** @brief Sends a header-only reply. */
+static bool sendHeader(int fd, uint8_t type, uint8_t status,
+                       const RemoteHeader *request) {
+  RemoteHeader reply = {REMOTE_MAGIC, type, status, 0, request->first,
+                        request->count};
+  return writeAll(fd, &reply, sizeof(reply));
+}
+
+int serveRemote(int inFd, int outFd, int worldCount, int32_t level,
+                uint64_t seed) {
+  if (worldCount <= 0)
+    return -1;
+
+  SiEnv **envs = (SiEnv **)calloc(worldCount, sizeof(SiEnv *));
+  SiObservation *sent =
+      (SiObservation *)calloc(worldCount, sizeof(SiObservation));
+  // Requests are at most 8 bytes per game, replies MAX_DELTA_SIZE
+  unsigned char *input = (unsigned char *)malloc(worldCount * 8);
+  unsigned char *output = (unsigned char *)malloc(
+      sizeof(RemoteHeader) + 4 + sizeof(RemoteHello) +
+      worldCount * MAX_DELTA_SIZE);
+
+  bool ok = envs && sent && input && output;
+  for (int i = 0; ok && i < worldCount; i++) {
+    envs[i] =
+        siCreate(SI_SCREEN_WIDTH, SI_SCREEN_HEIGHT, level, seed + (uint64_t)i);
+    ok = envs[i] != NULL;
+  }
+
+  int result = ok ? 0 : -1;
+  RemoteHeader request;
+  while (ok && readAll(inFd, &request, sizeof(request))) {
+    if (request.magic != REMOTE_MAGIC) {
+      sendHeader(outFd, REMOTE_ERROR, REMOTE_BAD_MAGIC, &request);
+      result = -1;
+      break;
+    }
+
+    // Payload size depends on the type
+    size_t itemSize = request.type == REMOTE_RESET  ? sizeof(uint64_t)
+                      : request.type == REMOTE_STEP ? 1
+                                                    : 0;
+    bool ranged = itemSize > 0;
+    if (ranged && (request.first > (uint32_t)worldCount ||
+                   request.count > (uint32_t)worldCount - request.first)) {
+      // Skip the payload to stay in sync, then report
+      bool drained = true;
+      for (uint32_t i = 0; drained && i < request.count; i++)
+        drained = readAll(inFd, input, itemSize);
+      if (!drained || !sendHeader(outFd, REMOTE_ERROR, REMOTE_BAD_RANGE,
+                                  &request))
+        break;
+      continue;
+    }
+    if (ranged && !readAll(inFd, input, request.count * itemSize))
+      break;
+
+    RemoteHeader *reply = (RemoteHeader *)output;
+    *reply = (RemoteHeader){REMOTE_MAGIC, request.type, REMOTE_OK,
+                            request.frameSkip, request.first, request.count};
+    size_t size = sizeof(RemoteHeader);
+    if (ranged)
+      size += sizeof(uint32_t); // Payload size, filled in below
+
+    if (request.type == REMOTE_HELLO) {
+      RemoteHello hello = {SI_API_VERSION, (uint32_t)worldCount,
+                           sizeof(SiObservation), 0};
+      memcpy(output + size, &hello, sizeof(hello));
+      size += sizeof(hello);
+    } else if (request.type == REMOTE_RESET) {
+      for (uint32_t i = 0; i < request.count; i++) {
+        uint64_t gameSeed;
+        memcpy(&gameSeed, input + i * sizeof(uint64_t), sizeof(gameSeed));
+        int index = (int)(request.first + i);
+
+        siReset(envs[index], gameSeed);
+        SiObservation now;
+        siObserve(envs[index], &now);
+        memset(&sent[index], 0, sizeof(SiObservation));
+        size += encodeDelta(output + size, &sent[index], &now, 0);
+      }
+    } else if (request.type == REMOTE_STEP) {
+      unsigned frames = request.frameSkip ? request.frameSkip : 1;
+      for (uint32_t i = 0; i < request.count; i++) {
+        int index = (int)(request.first + i);
+        SiAction action = {input[i] & REMOTE_ACTION_MOVE_MASK,
+                           (input[i] & REMOTE_ACTION_FIRE) != 0};
+
+        uint32_t events = 0;
+        for (unsigned f = 0; f < frames; f++) {
+          events |= siStep(envs[index], action);
+          if (events & (SI_EVENT_PLAYER_DIED | SI_EVENT_GAME_WON))
+            break;
+        }
+        SiObservation now;
+        siObserve(envs[index], &now);
+        size += encodeDelta(output + size, &sent[index], &now, events);
+      }
+    } else if (request.type == REMOTE_CLOSE) {
+      writeAll(outFd, output, size);
+      break;
+    } else {
+      reply->type = REMOTE_ERROR;
+      reply->status = REMOTE_BAD_TYPE;
+    }
+
+    if (ranged) {
+      uint32_t payload = (uint32_t)(size - sizeof(RemoteHeader) - 4);
+      memcpy(output + sizeof(RemoteHeader), &payload, sizeof(payload));
+    }
+    if (!writeAll(outFd, output, size)) {
+      result = -1;
+      break;
+    }
+  }
+
+  for (int i = 0; envs && i < worldCount; i++)
+    siDestroy(envs[i]);
+  free(envs);
+  free(sent);
+  free(input);
+  free(output);
+  return result;
+}
+
+// ==========================================
+//               CLIENT
+// ==========================================
+
+struct RemoteClient {
+  int inFd, outFd;
+  int worldCount;
+  SiObservation *observations; /**< Decoded state of every game. */
+  unsigned char *buffer;       /**< Request / reply scratch space. */
+  size_t bufferSize;
+  uint64_t bytesReceived;
+  bool connected;
+};
+
+/** @brief Reads one reply and decodes the deltas of `count` games. */
+static bool readObservations(RemoteClient *c, uint8_t type, int first,
+                             int count, uint32_t *events) {
+  RemoteHeader reply;
+  uint32_t payload;
+  c->connected = readAll(c->inFd, &reply, sizeof(reply)) &&
+                 reply.magic == REMOTE_MAGIC && reply.type == type &&
+                 readAll(c->inFd, &payload, sizeof(payload)) &&
+                 payload <= c->bufferSize &&
+                 readAll(c->inFd, c->buffer, payload);
+  if (!c->connected)
+    return false;
+  c->bytesReceived += sizeof(reply) + sizeof(payload) + payload;
+
+  size_t offset = 0;
+  for (int i = 0; i < count; i++) {
+    uint32_t gameEvents;
+    size_t used = decodeDelta(c->buffer + offset, payload - offset,
+                              &c->observations[first + i], &gameEvents);
+    if (used == 0) {
+      c->connected = false;
+      return false;
+    }
+    offset += used;
+    if (events)
+      events[i] = gameEvents;
+  }
+  return true;
+}
+
+RemoteClient *createRemoteClient(int inFd, int outFd) {
+  RemoteClient *c = (RemoteClient *)calloc(1, sizeof(RemoteClient));
+  if (!c)
+    return NULL;
+  c->inFd = inFd;
+  c->outFd = outFd;
+
+  RemoteHeader hello = {REMOTE_MAGIC, REMOTE_HELLO, REMOTE_OK, 0, 0, 0};
+  RemoteHeader reply;
+  RemoteHello info;
+  if (!writeAll(outFd, &hello, sizeof(hello)) ||
+      !readAll(inFd, &reply, sizeof(reply)) || reply.magic != REMOTE_MAGIC ||
+      reply.type != REMOTE_HELLO || !readAll(inFd, &info, sizeof(info)) ||
+      info.apiVersion != SI_API_VERSION ||
+      info.observationSize != sizeof(SiObservation)) {
+    free(c);
+    return NULL;
+  }
+
+  c->worldCount = (int)info.worldCount;
+  c->bufferSize = sizeof(RemoteHeader) + c->worldCount * MAX_DELTA_SIZE;
+  c->observations =
+      (SiObservation *)calloc(c->worldCount, sizeof(SiObservation));
+  c->buffer = (unsigned char *)malloc(c->bufferSize);
+  if (!c->observations || !c->buffer) {
+    free(c->observations);
+    free(c->buffer);
+    free(c);
+    return NULL;
+  }
+  c->connected = true;
+  return c;
+}
+
+void destroyRemoteClient(RemoteClient *c) {
+  if (!c)
+    return;
+
+  if (c->connected) {
+    RemoteHeader bye = {REMOTE_MAGIC, REMOTE_CLOSE, REMOTE_OK, 0, 0, 0};
+    RemoteHeader reply;
+    if (writeAll(c->outFd, &bye, sizeof(bye)))
+      readAll(c->inFd, &reply, sizeof(reply));
+  }
+  free(c->observations);
+  free(c->buffer);
+  free(c);
+}
+
+int getRemoteWorldCount(const RemoteClient *c) {
+  return c ? c->worldCount : 0;
+}
+
+const SiObservation *getRemoteObservation(const RemoteClient *c, int index) {
+  if (!c || index < 0 || index >= c->worldCount)
+    return NULL;
+  return &c->observations[index];
+}
+
+uint64_t getRemoteBytesReceived(const RemoteClient *c) {
+  return c ? c->bytesReceived : 0;
+}
+
+bool remoteReset(RemoteClient *c, int first, int count,
+                 const uint64_t *seeds) {
+  if (!c || !c->connected || first < 0 || count <= 0 ||
+      count > c->worldCount - first)
+    return false;
+
+  RemoteHeader request = {REMOTE_MAGIC, REMOTE_RESET, REMOTE_OK, 0,
+                          (uint32_t)first, (uint32_t)count};
+  memcpy(c->buffer, &request, sizeof(request));
+  memcpy(c->buffer + sizeof(request), seeds, count * sizeof(uint64_t));
+  if (!writeAll(c->outFd, c->buffer,
+                sizeof(request) + count * sizeof(uint64_t)))
+    return false;
+
+  // Deltas of a reset are relative to an empty observation
+  memset(&c->observations[first], 0, count * sizeof(SiObservation));
+  return readObservations(c, REMOTE_RESET, first, count, NULL);
+}
+
+bool remoteStep(RemoteClient *c, int first, int count,
+                const SiAction *actions, unsigned frameSkip,
+                uint32_t *events) {
+  if (!c || !c->connected || first < 0 || count <= 0 ||
+      count > c->worldCount - first || frameSkip > UINT16_MAX)
+    return false;
+
+  RemoteHeader request = {REMOTE_MAGIC,        REMOTE_STEP,
+                          REMOTE_OK,           (uint16_t)frameSkip,
+                          (uint32_t)first,     (uint32_t)count};
+  memcpy(c->buffer, &request, sizeof(request));
+  for (int i = 0; i < count; i++) {
+    c->buffer[sizeof(request) + i] =
+        (uint8_t)((actions[i].move & REMOTE_ACTION_MOVE_MASK) |
+                  (actions[i].fire ? REMOTE_ACTION_FIRE : 0));
+  }
+  if (!writeAll(c->outFd, c->buffer, sizeof(request) + count))
+    return false;
+
+  return readObservations(c, REMOTE_STEP, first, count, events);
+}
@@ -2,7 +2,7 @@
 #include <SDL3/SDL.h>
 
 bool handleInput(Player *player, Projectiles *projectiles, SDL_Context *view,
-                 GameState *state) {
+                 GameState *state, SimClock *clock, TimerTime now) {
   if (!player)
     return true;
 
@@ -20,6 +20,18 @@ bool handleInput(Player *player, Projectiles *projectiles, SDL_Context *view,
         toggleFullscreen(view);
       }
 
+      // Time scale: slow motion, fast forward, turbo
+      if (clock) {
+        if (event.key.scancode == SDL_SCANCODE_LEFTBRACKET)
+          setSimTimeScale(clock, clock->timeScale / 2.0);
+        else if (event.key.scancode == SDL_SCANCODE_RIGHTBRACKET)
+          setSimTimeScale(clock, clock->timeScale * 2.0);
+        else if (event.key.scancode == SDL_SCANCODE_0)
+          setSimTimeScale(clock, 1.0);
+        else if (event.key.scancode == SDL_SCANCODE_T)
+          setSimTurbo(clock, !clock->turbo);
+      }
+
       // --- MENU STATE ---
       if (*state == STATE_MENU) {
         if (event.key.scancode == SDL_SCANCODE_RETURN) {
@@ -74,7 +86,7 @@ bool handleInput(Player *player, Projectiles *projectiles, SDL_Context *view,
 
   // --- Shooting (New) ---
   if (keyState[SDL_SCANCODE_SPACE]) {
-    if (playerShoot(player, projectiles)) {
+    if (playerShoot(player, projectiles, now)) {
       playSound(view, SOUND_PLAYER_SHOOT);
     }
   }
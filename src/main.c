@@ -1,19 +1,36 @@
 #define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 // Shared Model Includes
+#include "../includes/aabb_simd.h"
 #include "../includes/bunker.h"
+#include "../includes/env_server.h"
 #include "../includes/enemy.h"
 #include "../includes/explosion.h"
 #include "../includes/game_state.h"
+#include "../includes/hit_mask.h"
 #include "../includes/physics.h"
 #include "../includes/player.h"
 #include "../includes/projectile.h"
+#include "../includes/raster.h"
+#include "../includes/remote_controller.h"
+#include "../includes/rng.h"
+#include "../includes/sim_clock.h"
 #include "../includes/storage.h"
+#include "../includes/world.h"
+#include "../includes/world_batch.h"
+#include "../includes/world_fork.h"
+#include "../includes/world_hash.h"
+#include "../includes/world_pool.h"
 
 // SDL Specific Includes
 #include "../includes/sdl_controller.h"
@@ -29,43 +46,78 @@
 // ==========================================
 #define GAME_WIDTH 800
 #define GAME_HEIGHT 600
-#define FPS 60
-#define FRAME_DELAY (1000 / FPS) // Target duration per frame (~16ms)
+#define FPS 60                // Frames drawn per second (interactive modes)
+#define FIXED_DT (1.0f / FPS) // Simulation step used by the headless mode
 
 /**
  * @brief Resets the game state for a replay.
  * * When the player dies or wins and hits "Enter", this function:
- * 1. Resets Player position and health.
- * 2. Destroys the old Swarm and Bullet pool.
- * 3. Allocates fresh Swarm and Bullets.
- * 4. Rebuilds the Bunkers.
- * * @note We use double pointers (Swarm **s) because we are modifying
- * the pointer itself (re-allocating memory).
+ * 1. Resets Player position, health and score (the high score is kept).
+ * 2. Reinitializes the Swarm, Bullet pool and Explosions in place.
+ * 3. Rebuilds the Bunkers.
+ * 4. Puts the game back on the Menu screen.
  */
-void resetGameLogic(Player *p, Swarm **s, Projectiles **b, BunkerManager *bk,
-                    int *lvl) {
-  p->x = GAME_WIDTH / 2.0f;
-  p->y = GAME_HEIGHT - 50;
-  p->health = 3;
-  p->score = 0;
-  // Note: We do NOT reset p->highScore here, it persists across replays.
-  *lvl = 1;
+void resetGameLogic(World *world) {
+  resetWorld(world);
+  world->state = STATE_MENU;
+}
 
-  // Hard Reset: Destroy old objects, create new ones
-  destroySwarm(*s);
-  *s = createSwarm(*lvl);
-  if (!*s) {
-    exit(EXIT_FAILURE);
+/**
+ * @brief Saves the high score if the game that just ended beat it.
+ */
+static void recordHighScore(Player *player) {
+  if (player->score > player->highScore) {
+    player->highScore = player->score;
+    saveHighScore(player->score);
   }
+}
 
-  destroyProjectiles(*b);
-  *b = createProjectiles(MAX_PROJECTILES);
-  if (!*b) {
-    exit(EXIT_FAILURE);
+/** @brief Options of the interactive loops (command line). */
+typedef struct {
+  double hz;        /**< Simulation rate (steps per second). */
+  double timeScale; /**< Initial time scale (1 = real time). */
+  int catchUp;      /**< Most steps per frame (0 = default budget). */
+} LoopOptions;
+
+/**
+ * @brief Reads [--hz HZ] [--time-scale S] [--catch-up N] from argv[first]
+ * on.
+ * @return false (after printing the usage) on an unknown or bad option.
+ */
+static bool parseLoopOptions(int argc, char *argv[], int first,
+                             LoopOptions *options) {
+  options->hz = SIM_DEFAULT_HZ;
+  options->timeScale = 1.0;
+  options->catchUp = 0;
+
+  for (int i = first; i < argc; i++) {
+    if (strcmp(argv[i], "--hz") == 0 && i + 1 < argc) {
+      options->hz = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--time-scale") == 0 && i + 1 < argc) {
+      options->timeScale = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--catch-up") == 0 && i + 1 < argc) {
+      options->catchUp = atoi(argv[++i]);
+    } else {
+      fprintf(stderr,
+              "Usage: %s [sdl | ncurses] [--hz HZ] [--time-scale S] "
+              "[--catch-up STEPS]\n",
+              argv[0]);
+      return false;
+    }
+  }
+  if (!(options->hz >= SIM_MIN_HZ && options->hz <= SIM_MAX_HZ) ||
+      !(options->timeScale > 0) || options->catchUp < 0) {
+    fprintf(stderr, "Invalid arguments: hz %d..%d, time scale > 0\n",
+            SIM_MIN_HZ, SIM_MAX_HZ);
+    return false;
   }
+  return true;
+}
 
-  // Restore shields
-  resetBunkers(bk, GAME_WIDTH);
+/** @brief Clock of a loop, as asked on the command line. */
+static void initLoopClock(SimClock *clock, const LoopOptions *options) {
+  initSimClock(clock, options->hz, options->catchUp);
+  setSimTimeScale(clock, options->timeScale);
 }
 
 // ==========================================
@@ -74,146 +126,99 @@ void resetGameLogic(Player *p, Swarm **s, Projectiles **b, BunkerManager *bk,
 /**
  * @brief The Main Game Loop for the Graphical (SDL) Mode.
  * Handles high-performance rendering, audio, and inputs.
+ * The model runs at a fixed rate (SimClock); the frames draw the World
+ * interpolated between its last two steps.
  */
-void runSDL() {
+void runSDL(const LoopOptions *options) {
   // 1. Initialization Phase
   SDL_Context *view = initSDLView(GAME_WIDTH, GAME_HEIGHT);
   if (!view)
     return;
 
-  Player *player = createPlayer(GAME_WIDTH / 2.0f, 30, 50);
-  if (!player) {
+  // All game entities live in a single World block, plus its state before
+  // the last step and the interpolated copy that gets drawn
+  World *world = createWorld(GAME_WIDTH, GAME_HEIGHT, 1, (uint64_t)time(NULL));
+  World *previous = (World *)malloc(sizeof(World));
+  World *drawn = (World *)malloc(sizeof(World));
+  if (!world || !previous || !drawn) {
+    destroyWorld(world);
+    free(previous);
+    free(drawn);
     destroySDLView(view);
     return;
   }
-  player->y = GAME_HEIGHT - 50;
+  world->state = STATE_MENU;
 
-  // --- ADDED: Load High Score from JSON ---
+  Player *player = &world->player;
   player->highScore = loadHighScore();
-  // ----------------------------------------
+  memcpy(previous, world, sizeof(World));
 
-  Swarm *swarm = createSwarm(1);
-  if (!swarm) {
-    destroyPlayer(player);
-    destroySDLView(view);
-    return;
-  }
-
-  Projectiles *bullets = createProjectiles(MAX_PROJECTILES);
-  if (!bullets) {
-    destroySwarm(swarm);
-    destroyPlayer(player);
-    destroySDLView(view);
-    return;
-  }
-
-  ExplosionManager *explosions = createExplosionManager();
-  if (!explosions) {
-    destroyProjectiles(bullets);
-    destroySwarm(swarm);
-    destroyPlayer(player);
-    destroySDLView(view);
-    return;
-  }
-
-  BunkerManager *bunkers = createBunkers(GAME_WIDTH);
-  if (!bunkers) {
-    destroyExplosionManager(explosions);
-    destroyProjectiles(bullets);
-    destroySwarm(swarm);
-    destroyPlayer(player);
-    destroySDLView(view);
-    return;
-  }
-
-  int currentLevel = 1;
-  GameState state = STATE_MENU;
   bool isRunning = true;
-  bool playerWon = false;
 
-  // Time Management for Delta Time
-  unsigned long lastTime = SDL_GetTicks();
+  // Time Management: fixed-rate clock fed with nanosecond frame times
+  SimClock clock;
+  initLoopClock(&clock, options);
+  Uint64 lastTime = SDL_GetTicksNS();
 
   // Time Management for Frame Capping
-  Uint32 frameStart;
-  int frameTime;
+  Uint64 frameStart;
 
   // 2. The Game Loop
   while (isRunning) {
-    frameStart = SDL_GetTicks(); // Record the start of this frame
+    frameStart = SDL_GetTicksNS(); // Record the start of this frame
 
-    // A. Calculate Delta Time
-    unsigned long currentTime = SDL_GetTicks();
-    float deltaTime = (currentTime - lastTime) / 1000.0f;
+    // A. Real time elapsed since the previous frame
+    Uint64 currentTime = SDL_GetTicksNS();
+    double frameSeconds = (double)(currentTime - lastTime) / SDL_NS_PER_SECOND;
     lastTime = currentTime;
 
     // B. INPUT
-    isRunning = handleInput(player, bullets, view, &state);
+    isRunning = handleInput(player, &world->projectiles, view, &world->state,
+                            &clock, world->clock);
 
-    // C. UPDATE (Game Logic)
-    if (state == STATE_PLAYING) {
-      updatePlayer(player, deltaTime, GAME_WIDTH);
-      updateProjectiles(bullets, deltaTime, GAME_HEIGHT);
-      updateSwarm(swarm, deltaTime, GAME_WIDTH);
-      updateExplosions(explosions, deltaTime);
+    // C. UPDATE (Game Logic): whole fixed steps only
+    if (world->state == STATE_PLAYING) {
+      int steps = advanceSimClock(&clock, frameSeconds);
+      unsigned events = WORLD_EVENT_NONE;
+      for (int i = 0; i < steps && world->state == STATE_PLAYING; i++) {
+        memcpy(previous, world, sizeof(World));
+        events |= updateWorld(world, getSimStep(&clock));
+      }
 
-      if (enemyAttemptShoot(swarm, bullets, deltaTime))
+      if (events & WORLD_EVENT_ENEMY_SHOOT)
         playSound(view, SOUND_ENEMY_SHOOT);
 
-      bool hit = false;
-      if (checkCollisions(player, swarm, bullets, explosions, bunkers, &hit)) {
-        // Player Died
+      if (events & WORLD_EVENT_PLAYER_DIED) {
         playSound(view, SOUND_PLAYER_EXPLOSION);
-
-        // --- ADDED: Save High Score on Death ---
-        if (player->score > player->highScore) {
-          player->highScore = player->score;
-          saveHighScore(player->score);
-        }
-        // ---------------------------------------
-
-        state = STATE_GAME_OVER;
-        playerWon = false;
+        recordHighScore(player);
       }
-      if (hit)
+      if (events & WORLD_EVENT_ENEMY_HIT)
         playSound(view, SOUND_ENEMY_EXPLOSION);
 
-      // Level Progression
-      if (isSwarmDestroyed(swarm)) {
-        currentLevel++;
-        if (currentLevel > 2) {
-          playerWon = true;
-
-          // --- ADDED: Save High Score on Win ---
-          if (player->score > player->highScore) {
-            player->highScore = player->score;
-            saveHighScore(player->score);
-          }
-          // -------------------------------------
-
-          state = STATE_GAME_OVER;
-        } else {
-          destroySwarm(swarm);
-          swarm = createSwarm(currentLevel);
-          destroyProjectiles(bullets);
-          bullets = createProjectiles(MAX_PROJECTILES);
-        }
-      }
+      if (events & WORLD_EVENT_GAME_WON)
+        recordHighScore(player);
+    } else {
+      // Menu, pause, game over: do not catch up on that time later
+      resetSimClock(&clock);
+      memcpy(previous, world, sizeof(World));
     }
 
-    // D. RENDER
-    renderSDL(view, player, bullets, swarm, explosions, bunkers, state,
-              playerWon);
+    // D. RENDER (between the last two steps)
+    interpolateWorld(drawn, previous, world, getSimAlpha(&clock));
+    renderSDL(view, &drawn->player, &drawn->projectiles, &drawn->swarm,
+              &drawn->explosions, &drawn->bunkers, drawn->state,
+              drawn->playerWon);
 
     // E. RESET CHECK
-    if (state == STATE_MENU && (player->score > 0 || !player->health)) {
-      resetGameLogic(player, &swarm, &bullets, bunkers, &currentLevel);
+    if (world->state == STATE_MENU && (player->score > 0 || !player->health)) {
+      resetGameLogic(world);
     }
 
-    // F. FRAME CAPPING (Force 60 FPS)
-    frameTime = SDL_GetTicks() - frameStart;
-    if (FRAME_DELAY > frameTime) {
-      SDL_Delay(FRAME_DELAY - frameTime);
+    // F. FRAME CAPPING (Force 60 FPS, none in turbo)
+    Uint64 frameTime = SDL_GetTicksNS() - frameStart;
+    Uint64 frameDelay = SDL_NS_PER_SECOND / FPS;
+    if (!clock.turbo && frameDelay > frameTime) {
+      SDL_DelayNS(frameDelay - frameTime);
     }
   }
 
@@ -221,11 +226,9 @@ void runSDL() {
   printf("Loop exited. Starting cleanup...\n");
 
   destroySDLView(view);
-  destroyPlayer(player);
-  destroySwarm(swarm);
-  destroyProjectiles(bullets);
-  destroyExplosionManager(explosions);
-  destroyBunkers(bunkers);
+  destroyWorld(world);
+  free(previous);
+  free(drawn);
 
   printf("Cleanup finished successfully.\n");
 }
@@ -235,128 +238,1781 @@ void runSDL() {
 // ==========================================
 /**
  * @brief The Game Loop for the Terminal (Ncurses) Mode.
+ * Same fixed-rate clock as the SDL loop; a character grid gains nothing
+ * from interpolation, so the last step is drawn as is.
  */
-void runNcurses() {
+void runNcurses(const LoopOptions *options) {
   Ncurses_Context *view = initNcursesView(GAME_WIDTH, GAME_HEIGHT);
   if (!view)
     return;
 
-  Player *player = createPlayer(GAME_WIDTH / 2.0f, 30, 50);
-  player->y = GAME_HEIGHT - 50;
+  World *world = createWorld(GAME_WIDTH, GAME_HEIGHT, 1, (uint64_t)time(NULL));
+  if (!world) {
+    destroyNcursesView(view);
+    return;
+  }
+  world->state = STATE_MENU;
 
-  // --- ADDED: Load High Score ---
+  Player *player = &world->player;
   player->highScore = loadHighScore();
-  // ------------------------------
 
-  Swarm *swarm = createSwarm(1);
-  Projectiles *bullets = createProjectiles(MAX_PROJECTILES);
-  ExplosionManager *explosions = createExplosionManager();
-  BunkerManager *bunkers = createBunkers(GAME_WIDTH);
-
-  int currentLevel = 1;
-  GameState state = STATE_MENU;
   bool isRunning = true;
-  bool playerWon = false;
   bool needsReset = false;
 
-  // POSIX Time Setup
+  // POSIX Time Setup (nanoseconds)
+  SimClock clock;
+  initLoopClock(&clock, options);
   struct timespec ts;
   clock_gettime(CLOCK_MONOTONIC, &ts);
-  unsigned long lastTime = (ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+  double lastTime = ts.tv_sec + ts.tv_nsec / 1e9;
 
   while (isRunning) {
     // A. Time Calculation
     clock_gettime(CLOCK_MONOTONIC, &ts);
-    unsigned long currentTime = (ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
-    float deltaTime = (currentTime - lastTime) / 1000.0f;
+    double currentTime = ts.tv_sec + ts.tv_nsec / 1e9;
+    float deltaTime = (float)(currentTime - lastTime);
     lastTime = currentTime;
 
     // B. Input
-    isRunning =
-        handleNcursesInput(player, bullets, &state, &needsReset, deltaTime);
+    isRunning = handleNcursesInput(player, &world->projectiles, &world->state,
+                                   &needsReset, deltaTime, &clock,
+                                   world->clock);
+
+    // C. Logic: whole fixed steps only
+    if (world->state == STATE_PLAYING) {
+      int steps = advanceSimClock(&clock, deltaTime);
+      unsigned events = WORLD_EVENT_NONE;
+      for (int i = 0; i < steps && world->state == STATE_PLAYING; i++)
+        events |= updateWorld(world, getSimStep(&clock));
 
-    // C. Logic
-    if (state == STATE_PLAYING) {
-      if (player->shootTimer > 0.0f) {
-        player->shootTimer -= deltaTime;
+      if (events & (WORLD_EVENT_PLAYER_DIED | WORLD_EVENT_GAME_WON))
+        recordHighScore(player);
+    } else {
+      resetSimClock(&clock);
+      if (world->state == STATE_MENU && needsReset) {
+        resetGameLogic(world);
+        needsReset = false;
       }
+    }
+
+    // D. Render
+    renderNcurses(view, player, &world->projectiles, &world->swarm,
+                  &world->explosions, &world->bunkers, world->state,
+                  world->playerWon);
+
+    // E. Throttle (16.6ms for ~60 FPS, none in turbo)
+    if (!clock.turbo) {
+      struct timespec sleepTs = {0, 16666667};
+      nanosleep(&sleepTs, NULL);
+    }
+  }
+
+  // Cleanup
+  destroyNcursesView(view);
+  destroyWorld(world);
+}
+
+// ==========================================
+//            HEADLESS RUNNER
+// ==========================================
+/**
+ * @brief Scripted input used when no human is playing.
+ * Sweeps the ship from wall to wall while firing continuously, so every
+ * system (movement, shooting, collisions, level changes) gets exercised.
+ */
+static WorldAction autopilot(const World *world) {
+  const Player *p = &world->player;
+  Direction sweep = (p->velocityX < 0) ? MOVE_LEFT : MOVE_RIGHT;
+
+  if (p->x <= 0)
+    sweep = MOVE_RIGHT;
+  else if (p->x >= FIXED((int)world->screenWidth - (int)p->width))
+    sweep = MOVE_LEFT;
+
+  WorldAction action = {sweep, true};
+  return action;
+}
+
+/**
+ * @brief Fixed-step simulation without any View (no SDL, no Ncurses).
+ * Usage: spaceinvaders headless [--frames N] [--seed S] [--level L]
+ *                                 [--dt SECONDS | --hz HZ]
+ * Steps the World at FIXED_DT (or --dt, or 1 / --hz) as fast as possible,
+ * restarting a new game whenever one ends, then reports the simulation
+ * throughput. Collisions are swept, so a coarse step (e.g., --hz 30 for
+ * batch runs) plays the same game.
+ */
+int runHeadless(int argc, char *argv[]) {
+  long frames = 100000;
+  uint64_t seed = 1;
+  int level = 1;
+  float dt = FIXED_DT;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+      level = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--dt") == 0 && i + 1 < argc) {
+      dt = strtof(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--hz") == 0 && i + 1 < argc) {
+      dt = 1.0f / strtof(argv[++i], NULL);
+    } else {
+      fprintf(stderr,
+              "Usage: %s headless [--frames N] [--seed S] [--level L] "
+              "[--dt SECONDS | --hz HZ]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (frames <= 0 || level < 1 || level > LEVEL_COUNT || !(dt > 0) ||
+      !isfinite(dt)) {
+    fprintf(stderr,
+            "Invalid arguments: frames and dt must be > 0, level 1..%d\n",
+            LEVEL_COUNT);
+    return EXIT_FAILURE;
+  }
+
+  World *world = createWorld(GAME_WIDTH, GAME_HEIGHT, level, seed);
+  if (!world)
+    return EXIT_FAILURE;
+
+  unsigned long games = 0, wins = 0;
+  unsigned long long totalScore = 0;
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  long steps = 0;
+  for (; steps < frames; steps++) {
+    stepWorld(world, autopilot(world), dt);
+
+    if (world->state == STATE_GAME_OVER) {
+      games++;
+      wins += world->playerWon;
+      totalScore += world->player.score;
+      resetWorld(world);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double elapsed =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+  printf("Frames: %ld (dt = %.4fs, seed = %llu, level = %d)\n", steps, dt,
+         (unsigned long long)seed, level);
+  printf("Games finished: %lu (won: %lu, avg score: %.1f)\n", games, wins,
+         games ? (double)totalScore / games : 0.0);
+  printf("Elapsed: %.3f s (world snapshot: %zu bytes)\n", elapsed,
+         sizeof(WorldSnapshot));
+  printf("Throughput: %.0f steps/sec, %.1f ns/step\n", steps / elapsed,
+         steps ? elapsed * 1e9 / steps : 0.0);
+
+  destroyWorld(world);
+  return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Copy-on-write fork benchmark (lookahead search pattern).
+ * Usage: spaceinvaders fork [--children K] [--depth D] [--seed S]
+ * Plays a root game for a few seconds, branches K children from it, steps
+ * each child D ticks with random inputs, then reports the memory used per
+ * fork compared to a full WorldSnapshot.
+ */
+int runForkBench(int argc, char *argv[]) {
+  long children = 10000;
+  long depth = 8;
+  uint64_t seed = 1;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--children") == 0 && i + 1 < argc) {
+      children = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+      depth = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else {
+      fprintf(stderr,
+              "Usage: %s fork [--children K] [--depth D] [--seed S]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (children <= 0 || depth < 0) {
+    fprintf(stderr, "Invalid arguments: children must be > 0\n");
+    return EXIT_FAILURE;
+  }
+
+  // 1. Play the root game for a while (bullets in flight, damaged bunkers)
+  World *world = createWorld(GAME_WIDTH, GAME_HEIGHT, 1, seed);
+  if (!world)
+    return EXIT_FAILURE;
+  for (int f = 0; f < 5 * FPS && world->state == STATE_PLAYING; f++)
+    stepWorld(world, autopilot(world), FIXED_DT);
+
+  WorldFork *root = createWorldFork(world);
+  WorldFork **forks = (WorldFork **)calloc(children, sizeof(WorldFork *));
+  if (!root || !forks) {
+    destroyWorldFork(root);
+    free(forks);
+    destroyWorld(world);
+    return EXIT_FAILURE;
+  }
+
+  // 2. Branch and explore
+  Rng rng;
+  seedRng(&rng, seed);
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  long created = 0;
+  for (; created < children; created++) {
+    forks[created] = forkWorld(root);
+    if (!forks[created])
+      break;
+
+    for (long d = 0; d < depth; d++) {
+      WorldAction action = {(Direction)((int)rngRange(&rng, 3) - 1),
+                            rngRange(&rng, 2) == 1};
+      stepWorldFork(forks[created], action, FIXED_DT);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double elapsed =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+  // 3. Memory report
+  size_t privateTotal = 0;
+  unsigned long sharedBlocks = 0;
+  for (long i = 0; i < created; i++) {
+    WorldForkStats stats = getWorldForkStats(forks[i]);
+    privateTotal += stats.privateBytes;
+    sharedBlocks += stats.sharedBlocks;
+  }
+  size_t rootBytes = getWorldForkStats(root).privateBytes +
+                     getWorldForkStats(root).sharedBytes;
+
+  printf("Forks: %ld children x %ld ticks (seed = %llu)\n", created, depth,
+         (unsigned long long)seed);
+  printf("Shared blocks per child: %.2f / %d\n",
+         created ? (double)sharedBlocks / created : 0.0, FORK_BLOCK_COUNT);
+  printf("Memory per fork: %.1f bytes (full snapshot: %zu bytes, root: %zu "
+         "bytes)\n",
+         created ? (double)privateTotal / created : 0.0, sizeof(WorldSnapshot),
+         rootBytes);
+  printf("Total: %.2f MiB with forks vs %.2f MiB with full copies\n",
+         (privateTotal + rootBytes) / (1024.0 * 1024.0),
+         (double)created * sizeof(WorldSnapshot) / (1024.0 * 1024.0));
+  printf("Throughput: %.0f forks/sec, %.1f ns/step\n", created / elapsed,
+         (created && depth) ? elapsed * 1e9 / (created * depth) : 0.0);
+
+  for (long i = 0; i < created; i++)
+    destroyWorldFork(forks[i]);
+  free(forks);
+  destroyWorldFork(root);
+  destroyWorld(world);
+  return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Compares the gameplay state of two Worlds.
+ * Dead bullet slots and padding bytes are ignored: only what stepWorld()
+ * can observe is compared.
+ */
+static bool sameGame(const World *a, const World *b) {
+  const Player *pa = &a->player, *pb = &b->player;
+  if (a->state != b->state || a->playerWon != b->playerWon ||
+      a->currentLevel != b->currentLevel || a->clock != b->clock ||
+      pa->x != pb->x || pa->y != pb->y ||
+      pa->shootReadyAt != pb->shootReadyAt || pa->health != pb->health ||
+      pa->score != pb->score || pa->animFrame != pb->animFrame ||
+      pa->animAt != pb->animAt)
+    return false;
 
-      updateProjectiles(bullets, deltaTime, GAME_HEIGHT);
-      updateSwarm(swarm, deltaTime, GAME_WIDTH);
-      updateExplosions(explosions, deltaTime);
-      enemyAttemptShoot(swarm, bullets, deltaTime);
+  const Projectiles *ra = &a->projectiles, *rb = &b->projectiles;
+  if (ra->count != rb->count || ra->capacity != rb->capacity)
+    return false;
+  for (unsigned k = 0; k < ra->count; k++) {
+    if (ra->x[k] != rb->x[k] || ra->y[k] != rb->y[k] ||
+        ra->velocityX[k] != rb->velocityX[k] ||
+        ra->velocityY[k] != rb->velocityY[k] ||
+        ra->prevX[k] != rb->prevX[k] || ra->prevY[k] != rb->prevY[k])
+      return false;
+  }
 
-      bool hit = false;
-      if (checkCollisions(player, swarm, bullets, explosions, bunkers, &hit)) {
+  const Swarm *sa = &a->swarm, *sb = &b->swarm;
+  for (int j = 0; j < TOTAL_ENEMIES; j++) {
+    if (sa->enemies[j].active != sb->enemies[j].active)
+      return false;
+  }
+  if (sa->originX != sb->originX || sa->originY != sb->originY)
+    return false;
+  return sa->kind == sb->kind && sa->direction == sb->direction &&
+         sa->lastMoveAt == sb->lastMoveAt && sa->shootAt == sb->shootAt &&
+         sa->rng.state == sb->rng.state &&
+         sa->boss.active == sb->boss.active && sa->boss.x == sb->boss.x &&
+         sa->boss.health == sb->boss.health &&
+         memcmp(&a->bunkers, &b->bunkers, sizeof(BunkerManager)) == 0 &&
+         memcmp(&a->explosions, &b->explosions, sizeof(ExplosionManager)) ==
+             0;
+}
 
-        // --- ADDED: Save High Score on Death ---
-        if (player->score > player->highScore) {
-          player->highScore = player->score;
-          saveHighScore(player->score);
+/**
+ * @brief Structure-of-Arrays batch benchmark (vectorized environment).
+ * Usage: spaceinvaders batch [--worlds N] [--frames F] [--seed S]
+ * Steps N games for F ticks, once as N separate Worlds and once as a
+ * WorldBatch, with the same random inputs, then checks that both end in the
+ * same state and reports the throughput of each layout.
+ */
+int runBatchBench(int argc, char *argv[]) {
+  long count = 1024;
+  long frames = 2000;
+  uint64_t seed = 1;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+      count = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else {
+      fprintf(stderr,
+              "Usage: %s batch [--worlds N] [--frames F] [--seed S]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (count <= 0 || frames <= 0) {
+    fprintf(stderr, "Invalid arguments: worlds and frames must be > 0\n");
+    return EXIT_FAILURE;
+  }
+
+  World *worlds = (World *)calloc(count, sizeof(World));
+  WorldAction *actions = (WorldAction *)malloc(count * sizeof(WorldAction));
+  WorldBatch *batch =
+      createWorldBatch((int)count, GAME_WIDTH, GAME_HEIGHT, 1, seed);
+  if (!worlds || !actions || !batch) {
+    free(worlds);
+    free(actions);
+    destroyWorldBatch(batch);
+    return EXIT_FAILURE;
+  }
+  for (long i = 0; i < count; i++)
+    initWorld(&worlds[i], GAME_WIDTH, GAME_HEIGHT, 1, seed + (uint64_t)i);
+
+  struct timespec start, end;
+  double elapsed[2];
+  unsigned long games[2] = {0, 0};
+
+  // Pass 0: one World at a time (AoS). Pass 1: the whole batch (SoA).
+  for (int pass = 0; pass < 2; pass++) {
+    Rng input;
+    seedRng(&input, seed);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (long f = 0; f < frames; f++) {
+      for (long i = 0; i < count; i++) {
+        actions[i].move = (Direction)((int)rngRange(&input, 3) - 1);
+        actions[i].fire = rngRange(&input, 2) == 1;
+      }
+
+      if (pass == 0) {
+        for (long i = 0; i < count; i++) {
+          stepWorld(&worlds[i], actions[i], FIXED_DT);
+          if (worlds[i].state == STATE_GAME_OVER) {
+            games[0]++;
+            resetWorld(&worlds[i]);
+          }
         }
-        // ---------------------------------------
+      } else {
+        stepWorldBatch(batch, actions, FIXED_DT, NULL);
+        for (long i = 0; i < count; i++) {
+          if (batch->state[i] == STATE_GAME_OVER) {
+            games[1]++;
+            resetBatchWorld(batch, (int)i);
+          }
+        }
+      }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    elapsed[pass] =
+        (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  }
+
+  // Both layouts must have played exactly the same games
+  long mismatches = 0;
+  World gathered;
+  for (long i = 0; i < count; i++) {
+    storeBatchWorld(batch, (int)i, &gathered);
+    if (!sameGame(&worlds[i], &gathered))
+      mismatches++;
+  }
+
+  double steps = (double)count * frames;
+  printf("Batch: %ld worlds x %ld frames (seed = %llu)\n", count, frames,
+         (unsigned long long)seed);
+  printf("Games finished: %lu (AoS) / %lu (SoA), mismatching worlds: %ld\n",
+         games[0], games[1], mismatches);
+  printf("AoS (World[]):    %.0f steps/sec, %.1f ns/step\n",
+         steps / elapsed[0], elapsed[0] * 1e9 / steps);
+  printf("SoA (WorldBatch): %.0f steps/sec, %.1f ns/step (x%.2f)\n",
+         steps / elapsed[1], elapsed[1] * 1e9 / steps,
+         elapsed[0] / elapsed[1]);
+
+  destroyWorldBatch(batch);
+  free(actions);
+  free(worlds);
+  return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/** @brief autopilot() with the WorldPolicy signature. */
+static WorldAction autopilotPolicy(const World *world, void *user) {
+  (void)user;
+  return autopilot(world);
+}
+
+/**
+ * @brief Multi-threaded stepping benchmark (work-stealing WorldPool).
+ * Usage: spaceinvaders threads [--worlds N] [--frames F] [--max-threads T]
+ *                              [--seed S] [--pin]
+ * Steps N autopiloted games for F ticks with 1, 2, 4... up to T threads
+ * (default: every online CPU) and prints the aggregate throughput of each
+ * run. The checksum must be identical on every line.
+ */
+int runThreadsBench(int argc, char *argv[]) {
+  long count = 4096;
+  long frames = 600;
+  long maxThreads = sysconf(_SC_NPROCESSORS_ONLN);
+  uint64_t seed = 1;
+  bool pin = false;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+      count = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--max-threads") == 0 && i + 1 < argc) {
+      maxThreads = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--pin") == 0) {
+      pin = true;
+    } else {
+      fprintf(stderr,
+              "Usage: %s threads [--worlds N] [--frames F] [--max-threads T] "
+              "[--seed S] [--pin]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (count <= 0 || frames <= 0 || maxThreads < 1) {
+    fprintf(stderr, "Invalid arguments: worlds, frames and threads must be "
+                    "> 0\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("Threads: %ld worlds x %ld frames (seed = %llu, pinned = %s)\n",
+         count, frames, (unsigned long long)seed, pin ? "yes" : "no");
+  printf("%8s %14s %9s %11s %10s %18s\n", "threads", "steps/sec", "speedup",
+         "efficiency", "steals", "checksum");
+
+  double baseline = 0.0;
+  long threads = 1;
+  while (threads <= maxThreads) {
+    WorldPoolConfig config = {(int)count, (int)threads, pin,     true,
+                              GAME_WIDTH, GAME_HEIGHT,  1,       seed,
+                              autopilotPolicy,          NULL};
+    WorldPool *pool = createWorldPool(&config);
+    if (!pool)
+      return EXIT_FAILURE;
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long f = 0; f < frames; f++)
+      stepWorldPool(pool, FIXED_DT);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed =
+        (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    // Same worlds, same inputs: the result must not depend on the threads
+    uint64_t checksum = 1469598103934665603ULL;
+    for (int i = 0; i < count; i++) {
+      const World *w = getWorldPoolWorld(pool, i);
+      checksum = (checksum ^ w->player.score) * 1099511628211ULL;
+      checksum = (checksum ^ w->swarm.rng.state) * 1099511628211ULL;
+    }
+
+    double rate = count * frames / elapsed;
+    if (threads == 1)
+      baseline = rate;
+    printf("%8ld %14.0f %8.2fx %10.1f%% %10llu %18llx\n", threads, rate,
+           rate / baseline, 100.0 * rate / baseline / threads,
+           getWorldPoolSteals(pool), (unsigned long long)checksum);
+    destroyWorldPool(pool);
+
+    // 1, 2, 4, ... then maxThreads itself
+    if (threads == maxThreads)
+      break;
+    threads = (threads * 2 > maxThreads) ? maxThreads : threads * 2;
+  }
+  return EXIT_SUCCESS;
+}
+
+/** @brief Sorts latencies for the percentiles of runServer(). */
+static int compareDoubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Fills one request: random inputs, new game where the last ended.
+ * @param over Per-game "game over" flags of this worker, updated later.
+ */
+static void fillEnvRequest(EnvCommand *commands, int worlds, const bool *over,
+                           Rng *rng, uint32_t frameSkip) {
+  for (int i = 0; i < worlds; i++) {
+    commands[i].type = over[i] ? ENV_COMMAND_RESET : ENV_COMMAND_STEP;
+    commands[i].frames = frameSkip;
+    commands[i].seed = nextRng(rng);
+    commands[i].action.move = (int32_t)rngRange(rng, 3);
+    commands[i].action.fire = (int32_t)rngRange(rng, 2);
+  }
+}
+
+/**
+ * @brief Multi-process environment server over shared memory.
+ * Usage: spaceinvaders server [--workers M] [--worlds K] [--steps S]
+ *                             [--seed S] [--name /shm] [--serve] [--clean]
+ * Forks M worker processes hosting K games each. By default the parent acts
+ * as the trainer: it measures the round-trip latency of one request, then
+ * the throughput of S batched steps on every worker. With --serve, the
+ * server runs until a client calls shutdownEnvServer(). --clean first
+ * removes the shm name left by a server that crashed.
+ */
+int runServer(int argc, char *argv[]) {
+  long workers = 2;
+  long worlds = 64;
+  long steps = 2000;
+  uint64_t seed = 1;
+  const char *name = "/spaceinvaders";
+  bool serve = false;
+  bool clean = false;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+      workers = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+      worlds = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+      steps = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--name") == 0 && i + 1 < argc) {
+      name = argv[++i];
+    } else if (strcmp(argv[i], "--serve") == 0) {
+      serve = true;
+    } else if (strcmp(argv[i], "--clean") == 0) {
+      clean = true;
+    } else {
+      fprintf(stderr,
+              "Usage: %s server [--workers M] [--worlds K] [--steps S] "
+              "[--seed S] [--name /shm] [--serve] [--clean]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (workers <= 0 || worlds <= 0 || steps <= 0) {
+    fprintf(stderr, "Invalid arguments: workers, worlds and steps must be "
+                    "> 0\n");
+    return EXIT_FAILURE;
+  }
 
-        state = STATE_GAME_OVER;
-        playerWon = false;
+  if (clean && removeEnvServer(name))
+    printf("Removed the stale shm '%s'\n", name);
+
+  fflush(stdout); // Do not duplicate buffered output in the workers
+  EnvServer *server =
+      createEnvServer(name, (int)workers, (int)worlds, 1, seed);
+  if (!server) {
+    if (errno == EEXIST)
+      fprintf(stderr,
+              "The shm '%s' already exists: another server runs, or one "
+              "crashed (then rerun with --clean)\n",
+              name);
+    else
+      fprintf(stderr, "Could not create the server '%s'\n", name);
+    return EXIT_FAILURE;
+  }
+
+  if (serve) {
+    printf("Serving %ld x %ld games on shm '%s'\n", workers, worlds, name);
+    fflush(stdout);
+    waitEnvServer(server);
+    destroyEnvServer(server);
+    return EXIT_SUCCESS;
+  }
+
+  bool *over = (bool *)calloc(workers * worlds, sizeof(bool));
+  long samples = steps < 10000 ? steps : 10000;
+  double *latency = (double *)malloc(samples * sizeof(double));
+  if (!over || !latency) {
+    free(over);
+    free(latency);
+    destroyEnvServer(server);
+    return EXIT_FAILURE;
+  }
+
+  Rng rng;
+  seedRng(&rng, seed);
+  struct timespec start, end;
+
+  // 1. Round-trip latency: one request to worker 0 at a time
+  for (long n = 0; n < samples; n++) {
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    fillEnvRequest(beginEnvRequest(server, 0), (int)worlds, over, &rng, 1);
+    submitEnvRequest(server, 0);
+    const EnvResult *results = waitEnvResponse(server, 0);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    for (long i = 0; results && i < worlds; i++)
+      over[i] = results[i].observation.status != SI_STATUS_PLAYING;
+    releaseEnvResponse(server, 0);
+    latency[n] = (end.tv_sec - start.tv_sec) * 1e6 +
+                 (end.tv_nsec - start.tv_nsec) / 1e3;
+  }
+  qsort(latency, samples, sizeof(double), compareDoubles);
+
+  // 2. Throughput: every worker steps its K games in parallel
+  unsigned long games = 0;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (long n = 0; n < steps; n++) {
+    for (long w = 0; w < workers; w++) {
+      fillEnvRequest(beginEnvRequest(server, (int)w), (int)worlds,
+                     over + w * worlds, &rng, 1);
+      submitEnvRequest(server, (int)w);
+    }
+    for (long w = 0; w < workers; w++) {
+      const EnvResult *results = waitEnvResponse(server, (int)w);
+      for (long i = 0; results && i < worlds; i++) {
+        bool ended = results[i].observation.status != SI_STATUS_PLAYING;
+        games += ended && !over[w * worlds + i];
+        over[w * worlds + i] = ended;
       }
+      releaseEnvResponse(server, (int)w);
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double elapsed =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
 
-      // Level Progression
-      if (isSwarmDestroyed(swarm)) {
-        currentLevel++;
-        if (currentLevel > 2) {
-          playerWon = true;
+  printf("Server: %ld workers x %ld worlds, %ld steps (seed = %llu)\n",
+         workers, worlds, steps, (unsigned long long)seed);
+  printf("Round-trip (%ld worlds): p50 %.1f us, p99 %.1f us, max %.1f us\n",
+         worlds, latency[samples / 2], latency[samples * 99 / 100],
+         latency[samples - 1]);
+  printf("Throughput: %.0f world-steps/sec, %.0f batches/sec (%lu games "
+         "finished)\n",
+         workers * worlds * steps / elapsed, steps / elapsed, games);
 
-          // --- ADDED: Save High Score on Win ---
-          if (player->score > player->highScore) {
-            player->highScore = player->score;
-            saveHighScore(player->score);
-          }
-          // -------------------------------------
-
-          state = STATE_GAME_OVER;
-        } else {
-          destroySwarm(swarm);
-          swarm = createSwarm(currentLevel);
-          destroyProjectiles(bullets);
-          bullets = createProjectiles(MAX_PROJECTILES);
+  free(latency);
+  free(over);
+  destroyEnvServer(server);
+  return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Drives a protocol server running in a child process.
+ * Steps every game with random inputs, resetting the ones that end, and
+ * optionally replays the same inputs on local games to check that the
+ * decoded observations are exact.
+ */
+static int runRemoteBench(long worlds, long steps, unsigned frameSkip,
+                          uint64_t seed, bool verify) {
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    return EXIT_FAILURE;
+
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    _exit(serveRemote(fds[1], fds[1], (int)worlds, 1, seed) == 0
+              ? EXIT_SUCCESS
+              : EXIT_FAILURE);
+  }
+  close(fds[1]);
+
+  RemoteClient *client = pid > 0 ? createRemoteClient(fds[0], fds[0]) : NULL;
+  SiAction *actions = (SiAction *)malloc(worlds * sizeof(SiAction));
+  SiEnv **mirror = (SiEnv **)calloc(worlds, sizeof(SiEnv *));
+  if (!client || !actions || !mirror) {
+    destroyRemoteClient(client);
+    free(actions);
+    free(mirror);
+    close(fds[0]);
+    return EXIT_FAILURE;
+  }
+  for (long i = 0; verify && i < worlds; i++)
+    mirror[i] = siCreate(SI_SCREEN_WIDTH, SI_SCREEN_HEIGHT, 1, seed + i);
+
+  Rng rng;
+  seedRng(&rng, seed);
+  long messages = 0, mismatches = 0;
+  unsigned long games = 0;
+  uint64_t bytesBefore = getRemoteBytesReceived(client);
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (long n = 0; n < steps; n++) {
+    for (long i = 0; i < worlds; i++) {
+      actions[i].move = (int32_t)rngRange(&rng, 3);
+      actions[i].fire = (int32_t)rngRange(&rng, 2);
+    }
+    remoteStep(client, 0, (int)worlds, actions, frameSkip, NULL);
+    messages++;
+
+    for (long i = 0; i < worlds; i++) {
+      for (unsigned f = 0; verify && f < (frameSkip ? frameSkip : 1); f++) {
+        if (siStep(mirror[i], actions[i]) &
+            (SI_EVENT_PLAYER_DIED | SI_EVENT_GAME_WON))
+          break;
+      }
+
+      if (getRemoteObservation(client, (int)i)->status != SI_STATUS_PLAYING) {
+        uint64_t gameSeed = nextRng(&rng);
+        remoteReset(client, (int)i, 1, &gameSeed);
+        if (verify)
+          siReset(mirror[i], gameSeed);
+        messages++;
+        games++;
+      }
+
+      if (verify) {
+        SiObservation local;
+        siObserve(mirror[i], &local);
+        mismatches += memcmp(&local, getRemoteObservation(client, (int)i),
+                             sizeof(SiObservation)) != 0;
+      }
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double elapsed =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  double perObservation =
+      (double)(getRemoteBytesReceived(client) - bytesBefore) /
+      ((double)worlds * steps);
+
+  printf("Remote: %ld worlds x %ld steps, frame-skip %u (seed = %llu)\n",
+         worlds, steps, frameSkip ? frameSkip : 1, (unsigned long long)seed);
+  printf("Messages: %.0f round-trips/sec (%ld sent, %lu games finished)\n",
+         messages / elapsed, messages, games);
+  printf("Throughput: %.0f world-ticks/sec\n",
+         worlds * steps * (frameSkip ? frameSkip : 1) / elapsed);
+  printf("Observation: %.1f bytes on the wire vs %zu bytes raw\n",
+         perObservation, sizeof(SiObservation));
+  if (verify)
+    printf("Verify: %ld mismatching observations\n", mismatches);
+
+  destroyRemoteClient(client);
+  close(fds[0]);
+  waitpid(pid, NULL, 0);
+  for (long i = 0; verify && i < worlds; i++)
+    siDestroy(mirror[i]);
+  free(mirror);
+  free(actions);
+  return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/**
+ * @brief Binary control protocol for external bots.
+ * Usage: spaceinvaders remote (--stdio | --socket PATH | --bench)
+ *                             [--worlds N] [--seed S] [--steps S]
+ *                             [--frame-skip F] [--verify]
+ * --stdio serves one client on stdin/stdout, --socket serves clients one
+ * after the other on a UNIX socket, --bench measures the protocol against
+ * a server running in a child process.
+ */
+int runRemote(int argc, char *argv[]) {
+  long worlds = 256;
+  long steps = 2000;
+  long frameSkip = 1;
+  uint64_t seed = 1;
+  const char *socketPath = NULL;
+  bool useStdio = false, bench = false, verify = false;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+      worlds = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+      steps = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--frame-skip") == 0 && i + 1 < argc) {
+      frameSkip = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+      socketPath = argv[++i];
+    } else if (strcmp(argv[i], "--stdio") == 0) {
+      useStdio = true;
+    } else if (strcmp(argv[i], "--bench") == 0) {
+      bench = true;
+    } else if (strcmp(argv[i], "--verify") == 0) {
+      verify = true;
+    } else {
+      socketPath = NULL, useStdio = bench = false;
+      break;
+    }
+  }
+  if (worlds <= 0 || steps <= 0 || frameSkip < 0 || frameSkip > UINT16_MAX ||
+      (!socketPath && !useStdio && !bench)) {
+    fprintf(stderr,
+            "Usage: %s remote (--stdio | --socket PATH | --bench) "
+            "[--worlds N] [--seed S] [--steps S] [--frame-skip F] "
+            "[--verify]\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (bench)
+    return runRemoteBench(worlds, steps, (unsigned)frameSkip, seed, verify);
+  if (useStdio) {
+    return serveRemote(STDIN_FILENO, STDOUT_FILENO, (int)worlds, 1, seed) == 0
+               ? EXIT_SUCCESS
+               : EXIT_FAILURE;
+  }
+
+  int listener = openRemoteSocket(socketPath);
+  if (listener < 0) {
+    fprintf(stderr, "Could not listen on '%s'\n", socketPath);
+    return EXIT_FAILURE;
+  }
+  printf("Listening on %s (%ld worlds per client)\n", socketPath, worlds);
+  fflush(stdout);
+  for (;;) {
+    int connection = accept(listener, NULL, NULL);
+    if (connection < 0)
+      break;
+    serveRemote(connection, connection, (int)worlds, 1, seed);
+    close(connection);
+  }
+  close(listener);
+  return EXIT_SUCCESS;
+}
+
+/**
+ * @brief SIMD AABB kernel benchmark and differential check.
+ * Usage: spaceinvaders aabb [--queries Q] [--seed S]
+ * Tests Q random boxes against 4, 8, 16 and 32 boxes with every kernel the
+ * CPU supports (overlapBoxes()), and checks that each returns exactly the
+ * masks of the scalar kernel.
+ */
+int runAabbBench(int argc, char *argv[]) {
+  long queries = 1000000;
+  uint64_t seed = 1;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--queries") == 0 && i + 1 < argc) {
+      queries = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else {
+      fprintf(stderr, "Usage: %s aabb [--queries Q] [--seed S]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (queries <= 0) {
+    fprintf(stderr, "Invalid arguments: queries must be > 0\n");
+    return EXIT_FAILURE;
+  }
+
+  // Boxes of 16 x 16 px and queries of a projectile's size, on quarter
+  // pixels of a 128 x 128 px area: about one query in four hits something
+  const int sizes[] = {4, 8, 16, AABB_BATCH_MAX};
+  const int sizeCount = (int)(sizeof(sizes) / sizeof(sizes[0]));
+  const int queryCount = 4096;
+  const Fixed quarter = FIXED_ONE / 4;
+  Fixed bx[AABB_BATCH_MAX], by[AABB_BATCH_MAX];
+  Fixed qx[4096], qy[4096];
+  uint32_t expected[4096];
+
+  Rng rng;
+  seedRng(&rng, seed);
+  for (int i = 0; i < AABB_BATCH_MAX; i++) {
+    bx[i] = (Fixed)rngRange(&rng, 4 * 112) * quarter;
+    by[i] = (Fixed)rngRange(&rng, 4 * 112) * quarter;
+  }
+  for (int q = 0; q < queryCount; q++) {
+    qx[q] = (Fixed)rngRange(&rng, 4 * 128) * quarter - FIXED(8);
+    qy[q] = (Fixed)rngRange(&rng, 4 * 128) * quarter - FIXED(8);
+  }
+
+  AabbKernel selected = getAabbKernel();
+  int status = EXIT_SUCCESS;
+  printf("AABB kernels: %ld queries (seed = %llu, selected: %s)\n", queries,
+         (unsigned long long)seed, getAabbKernelName(selected));
+
+  for (int s = 0; s < sizeCount; s++) {
+    int count = sizes[s];
+    double scalarTime = 0.0;
+
+    for (int k = 0; k < AABB_KERNEL_COUNT; k++) {
+      if (!setAabbKernel((AabbKernel)k)) {
+        printf("  %2d boxes, %-6s: not supported\n", count,
+               getAabbKernelName((AabbKernel)k));
+        continue;
+      }
+
+      // Reference masks: scalar kernel, always first
+      long mismatches = 0;
+      for (int q = 0; q < queryCount; q++) {
+        uint32_t mask = overlapBoxes(qx[q], qy[q], FIXED(PROJECTILE_WIDTH),
+                                     FIXED(PROJECTILE_HEIGHT), bx, by,
+                                     FIXED(16), FIXED(16), count);
+        if (k == AABB_KERNEL_SCALAR)
+          expected[q] = mask;
+        mismatches += mask != expected[q];
+      }
+
+      uint32_t checksum = 0;
+      struct timespec start, end;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (long q = 0; q < queries; q++) {
+        int i = (int)(q & (queryCount - 1));
+        checksum += overlapBoxes(qx[i], qy[i], FIXED(PROJECTILE_WIDTH),
+                                 FIXED(PROJECTILE_HEIGHT), bx, by, FIXED(16),
+                                 FIXED(16), count);
+      }
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      double elapsed =
+          (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+      if (k == AABB_KERNEL_SCALAR)
+        scalarTime = elapsed;
+
+      printf("  %2d boxes, %-6s: %6.2f ns/query (x%.2f), checksum %08x, "
+             "mismatches: %ld\n",
+             count, getAabbKernelName((AabbKernel)k),
+             elapsed * 1e9 / queries, scalarTime / elapsed,
+             (unsigned)checksum, mismatches);
+      if (mismatches)
+        status = EXIT_FAILURE;
+    }
+  }
+
+  setAabbKernel(selected);
+  return status;
+}
+
+/**
+ * @brief Differential check of the grid-indexed swarm hit test.
+ * Usage: spaceinvaders hittest [--states N] [--seed S]
+ * Plays an autopilot game and, on N level-1 swarm states (with random
+ * extra kills), places a bullet at every pixel around the swarm (plus a
+ * random sub-pixel offset). findSwarmHit() must return exactly the enemy
+ * the full scan scanSwarmHit() finds. Reports mismatches and the cost of
+ * both lookups.
+ */
+int runHitTest(int argc, char *argv[]) {
+  long states = 64;
+  uint64_t seed = 1;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--states") == 0 && i + 1 < argc) {
+      states = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else {
+      fprintf(stderr, "Usage: %s hittest [--states N] [--seed S]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (states <= 0) {
+    fprintf(stderr, "Invalid arguments: states must be > 0\n");
+    return EXIT_FAILURE;
+  }
+
+  World world;
+  initWorld(&world, GAME_WIDTH, GAME_HEIGHT, 1, seed);
+  Rng rng;
+  seedRng(&rng, seed);
+
+  long lookups = 0, hits = 0, mismatches = 0;
+  double elapsed[2] = {0.0, 0.0};
+  long checksum[2] = {0, 0};
+
+  for (long n = 0; n < states; n++) {
+    // Advance the game to a new swarm position
+    do {
+      for (int t = 0; t < 30; t++)
+        stepWorld(&world, autopilot(&world), FIXED_DT);
+      if (world.state == STATE_GAME_OVER || world.swarm.kind != SWARM_GRID)
+        initWorld(&world, GAME_WIDTH, GAME_HEIGHT, 1, seed + n);
+    } while (world.swarm.kind != SWARM_GRID);
+
+    Swarm swarm = world.swarm;
+    for (int j = 0; j < TOTAL_ENEMIES; j++) {
+      if (rngRange(&rng, 4) == 0)
+        killSwarmEnemy(&swarm, j);
+    }
+
+    Fixed x0 = swarm.originX - FIXED(60);
+    Fixed y0 = swarm.originY - FIXED(40);
+    Fixed x1 = x0 + FIXED(ENEMY_COLS * ENEMY_PITCH_X + 80);
+    Fixed y1 = y0 + FIXED(ENEMY_ROWS * ENEMY_PITCH_Y + 60);
+    Fixed fraction = (Fixed)rngRange(&rng, FIXED_ONE);
+
+    // Pass 0: grid lookup, pass 1: full scan (same bullets)
+    int *found[2];
+    long cells = (long)fixedFloor(x1 - x0) * fixedFloor(y1 - y0);
+    found[0] = (int *)malloc(cells * sizeof(int));
+    found[1] = (int *)malloc(cells * sizeof(int));
+    if (!found[0] || !found[1]) {
+      free(found[0]);
+      free(found[1]);
+      return EXIT_FAILURE;
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+      struct timespec start, end;
+      long k = 0;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      Fixed w = FIXED(PROJECTILE_WIDTH), h = FIXED(PROJECTILE_HEIGHT);
+      for (Fixed y = y0; y < y1; y += FIXED_ONE) {
+        for (Fixed x = x0; x < x1 && k < cells; x += FIXED_ONE, k++) {
+          Fixed bx = x + fraction, by = y + fraction;
+          found[pass][k] = pass == 0 ? findSwarmHit(&swarm, bx, by, w, h)
+                                     : scanSwarmHit(&swarm, bx, by, w, h);
+          checksum[pass] += found[pass][k];
         }
       }
-    } else if (state == STATE_MENU && needsReset) {
-      resetGameLogic(player, &swarm, &bullets, bunkers, &currentLevel);
-      needsReset = false;
-      playerWon = false;
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      elapsed[pass] +=
+          (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+      if (pass == 0)
+        lookups += k;
     }
 
-    // D. Render
-    renderNcurses(view, player, bullets, swarm, explosions, bunkers, state,
-                  playerWon);
+    for (long k = 0; k < cells; k++) {
+      if (found[0][k] != found[1][k])
+        mismatches++;
+      if (found[1][k] >= 0)
+        hits++;
+    }
+    free(found[0]);
+    free(found[1]);
+  }
+
+  printf("Hit test: %ld swarm states, %ld bullets (%ld hits, seed = %llu)\n",
+         states, lookups, hits, (unsigned long long)seed);
+  printf("Grid lookup: %.1f ns/bullet, full scan: %.1f ns/bullet (x%.1f)\n",
+         elapsed[0] * 1e9 / lookups, elapsed[1] * 1e9 / lookups,
+         elapsed[1] / elapsed[0]);
+  printf("Mismatches: %ld\n", mismatches);
+  return mismatches == 0 && checksum[0] == checksum[1] ? EXIT_SUCCESS
+                                                       : EXIT_FAILURE;
+}
 
-    // E. Throttle (16.6ms for ~60 FPS)
-    struct timespec sleepTs = {0, 16666667};
-    nanosleep(&sleepTs, NULL);
+/** @brief Paths tested per hit mask by the mask check. */
+#define MASK_TEST_PATHS 4096
+
+/**
+ * @brief Differential check and cost of the pixel-accurate hit test.
+ * Usage: spaceinvaders masktest [--queries Q] [--seed S]
+ * For every hit mask, random vertical paths of a projectile (up, down or
+ * still, on quarter pixels around the sprite) are swept against the mask.
+ * sweepHitMask() must return exactly the hit and time of impact found by
+ * sweeping the projectile against each opaque pixel as a 1 x 1 box
+ * (sweepBox()). Then reports the cost of the box test alone and of the
+ * box test followed by the mask test, on Q paths.
+ */
+int runMaskTest(int argc, char *argv[]) {
+  long queries = 1000000;
+  uint64_t seed = 1;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--queries") == 0 && i + 1 < argc) {
+      queries = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else {
+      fprintf(stderr, "Usage: %s masktest [--queries Q] [--seed S]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (queries <= 0) {
+    fprintf(stderr, "Invalid arguments: queries must be > 0\n");
+    return EXIT_FAILURE;
   }
 
-  // Cleanup
-  destroyNcursesView(view);
-  destroyPlayer(player);
-  destroySwarm(swarm);
-  destroyProjectiles(bullets);
-  destroyExplosionManager(explosions);
-  destroyBunkers(bunkers);
+  static const char *const names[HIT_MASK_COUNT] = {"alien_1", "alien_2",
+                                                    "boss"};
+  const Fixed w = FIXED(PROJECTILE_WIDTH), h = FIXED(PROJECTILE_HEIGHT);
+  const Fixed quarter = FIXED_ONE / 4;
+  Fixed px[MASK_TEST_PATHS], py0[MASK_TEST_PATHS], py1[MASK_TEST_PATHS];
+  int status = EXIT_SUCCESS;
+  Rng rng;
+  seedRng(&rng, seed);
+
+  printf("Mask test: %d paths per mask, %ld timed (seed = %llu)\n",
+         MASK_TEST_PATHS, queries, (unsigned long long)seed);
+  for (int id = 0; id < HIT_MASK_COUNT; id++) {
+    const HitMask *mask = getHitMask((HitMaskId)id);
+    Fixed mw = FIXED(mask->width), mh = FIXED(mask->height);
+    int opaque = 0;
+    for (int x = 0; x < mask->width; x++)
+      opaque += __builtin_popcountll(mask->columns[x]);
+
+    // Paths of up to 2 sprite heights, starting anywhere around the sprite
+    for (int q = 0; q < MASK_TEST_PATHS; q++) {
+      px[q] = (Fixed)rngRange(&rng, 4 * (mask->width + 12)) * quarter - w -
+              FIXED_ONE;
+      py0[q] = (Fixed)rngRange(&rng, 4 * (3 * mask->height)) * quarter - mh;
+      Fixed move = (Fixed)rngRange(&rng, 4 * (2 * mask->height)) * quarter;
+      int kind = (int)rngRange(&rng, 3);
+      py1[q] = kind == 0 ? py0[q] - move : kind == 1 ? py0[q] + move : py0[q];
+    }
+
+    long hits = 0, mismatches = 0;
+    for (int q = 0; q < MASK_TEST_PATHS; q++) {
+      Fixed t, expected = 2 * FIXED_ONE;
+      for (int y = 0; y < mask->height; y++) {
+        for (int x = 0; x < mask->width; x++) {
+          if (isHitMaskPixelSet(mask, x, y) &&
+              sweepBox(px[q], py0[q], px[q], py1[q], w, h, FIXED(x), FIXED(y),
+                       FIXED_ONE, FIXED_ONE, &t) &&
+              t < expected)
+            expected = t;
+        }
+      }
+      bool hit = sweepHitMask(mask, px[q], py0[q], px[q], py1[q], w, h, &t);
+      hits += hit;
+      if (hit != (expected <= FIXED_ONE) || (hit && t != expected))
+        mismatches++;
+    }
+
+    // Pass 0: box only, pass 1: box then mask (as findImpact())
+    double elapsed[2];
+    long checksum = 0;
+    for (int pass = 0; pass < 2; pass++) {
+      struct timespec start, end;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (long n = 0; n < queries; n++) {
+        int q = (int)(n & (MASK_TEST_PATHS - 1));
+        Fixed t;
+        bool hit =
+            sweepBox(px[q], py0[q], px[q], py1[q], w, h, 0, 0, mw, mh, &t);
+        if (pass == 1 && hit)
+          hit = sweepHitMask(mask, px[q], py0[q], px[q], py1[q], w, h, &t);
+        checksum += hit;
+      }
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      elapsed[pass] =
+          (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    }
+
+    printf("  %-7s %2dx%-2d (%4.1f%% opaque): %ld hits, box: %.1f ns/path, "
+           "box + mask: %.1f ns/path (checksum %ld), mismatches: %ld\n",
+           names[id], mask->width, mask->height,
+           100.0 * opaque / (mask->width * mask->height), hits,
+           elapsed[0] * 1e9 / queries, elapsed[1] * 1e9 / queries, checksum,
+           mismatches);
+    if (mismatches)
+      status = EXIT_FAILURE;
+  }
+  return status;
+}
+
+/** @brief Number of distinct game states replayed by the render benchmark. */
+#define RENDER_BENCH_STATES 256
+
+/**
+ * @brief Software rasterizer benchmark (pixel observations).
+ * Usage: spaceinvaders render [--width W] [--height H] [--rgb]
+ *        [--frames N] [--seed S] [--out FILE]
+ * Records RENDER_BENCH_STATES states of an autopilot game, then rasterizes
+ * them in turn for N frames and reports the observations per second.
+ * --out writes the last frame as a PGM (gray) or PPM (RGB) image.
+ */
+int runRenderBench(int argc, char *argv[]) {
+  long width = 84;
+  long height = 84;
+  long frames = 200000;
+  uint64_t seed = 1;
+  RasterFormat format = RASTER_GRAY;
+  const char *outPath = NULL;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--width") == 0 && i + 1 < argc) {
+      width = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--height") == 0 && i + 1 < argc) {
+      height = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--rgb") == 0) {
+      format = RASTER_RGB;
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      outPath = argv[++i];
+    } else {
+      fprintf(stderr,
+              "Usage: %s render [--width W] [--height H] [--rgb] "
+              "[--frames N] [--seed S] [--out FILE]\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (width <= 0 || height <= 0 || frames <= 0) {
+    fprintf(stderr, "Invalid arguments: sizes and frames must be > 0\n");
+    return EXIT_FAILURE;
+  }
+
+  Rasterizer *raster = createRasterizer((unsigned)width, (unsigned)height,
+                                        format, GAME_WIDTH, GAME_HEIGHT);
+  World *states = (World *)calloc(RENDER_BENCH_STATES, sizeof(World));
+  uint8_t *pixels = raster ? (uint8_t *)malloc(getRasterFrameSize(raster))
+                           : NULL;
+  if (!raster || !states || !pixels) {
+    fprintf(stderr, "Could not create a %ldx%ld rasterizer\n", width,
+            height);
+    destroyRasterizer(raster);
+    free(states);
+    free(pixels);
+    return EXIT_FAILURE;
+  }
+
+  // Record states a few ticks apart, so bullets and explosions are on screen
+  World world;
+  initWorld(&world, GAME_WIDTH, GAME_HEIGHT, 1, seed);
+  for (int i = 0; i < RENDER_BENCH_STATES; i++) {
+    for (int t = 0; t < 8; t++) {
+      stepWorld(&world, autopilot(&world), FIXED_DT);
+      if (world.state == STATE_GAME_OVER)
+        resetWorld(&world);
+    }
+    states[i] = world;
+  }
+
+  struct timespec start, end;
+  uint64_t checksum = 0;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (long f = 0; f < frames; f++) {
+    rasterizeWorld(raster, pixels, &states[f % RENDER_BENCH_STATES]);
+    checksum += pixels[(size_t)f % getRasterFrameSize(raster)];
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double elapsed =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+  printf("Render: %ldx%ld %s, %ld frames (seed = %llu)\n", width, height,
+         format == RASTER_RGB ? "RGB" : "gray", frames,
+         (unsigned long long)seed);
+  printf("%.0f observations/sec, %.1f ns/observation (checksum %llu)\n",
+         frames / elapsed, elapsed * 1e9 / frames,
+         (unsigned long long)checksum);
+
+  int status = EXIT_SUCCESS;
+  if (outPath) {
+    FILE *file = fopen(outPath, "wb");
+    if (file) {
+      fprintf(file, "P%c\n%ld %ld\n255\n", format == RASTER_RGB ? '6' : '5',
+              width, height);
+      fwrite(pixels, 1, getRasterFrameSize(raster), file);
+      fclose(file);
+    } else {
+      fprintf(stderr, "Could not write '%s'\n", outPath);
+      status = EXIT_FAILURE;
+    }
+  }
+
+  destroyRasterizer(raster);
+  free(states);
+  free(pixels);
+  return status;
+}
+
+// ==========================================
+//             DESYNC CHECK
+// ==========================================
+
+/** @brief Ticks played by the desync check (10 minutes at 60 Hz). */
+#define DESYNC_FRAMES 36000
+
+/** @brief Fields printed when two games diverge. */
+#define DESYNC_DIFF_LINES 40
+
+/** @brief Commands sent to a peer build after each of its hashes. */
+#define DESYNC_CONTINUE 'C' // Step the next tick
+#define DESYNC_DUMP 'D'     // Send the WorldSnapshot of this tick, stop
+#define DESYNC_QUIT 'Q'     // Stop
+
+/** @brief Ways of stepping a game (they must all play the same). */
+typedef enum {
+  DESYNC_RUNNER_WORLD, /**< stepWorld() on a World. */
+  DESYNC_RUNNER_BATCH, /**< stepWorldBatch() on a batch of one game. */
+  DESYNC_RUNNER_FORK,  /**< stepWorldFork() on a copy-on-write fork. */
+  DESYNC_RUNNER_COUNT
+} DesyncRunner;
+
+static const char *const desyncRunnerNames[DESYNC_RUNNER_COUNT] = {
+    "world", "batch", "fork"};
+
+/** @brief One side of a desync check: a game and the way it is stepped. */
+typedef struct {
+  DesyncRunner runner;
+  AabbKernel kernel; /**< AABB kernel selected while stepping. */
+  World world;       /**< The game (world runner) or its last state. */
+  WorldBatch *batch; /**< Batch runner only. */
+  WorldFork *fork;   /**< Fork runner only. */
+} DesyncSide;
+
+/**
+ * @brief Reads a configuration "RUNNER[:KERNEL]" (e.g., "batch:avx2").
+ * Without a kernel, the one picked when the program started is used.
+ */
+static bool parseDesyncSide(const char *text, DesyncSide *side) {
+  const char *colon = strchr(text, ':');
+  size_t length = colon ? (size_t)(colon - text) : strlen(text);
+
+  side->runner = DESYNC_RUNNER_COUNT;
+  for (int r = 0; r < DESYNC_RUNNER_COUNT; r++) {
+    if (strlen(desyncRunnerNames[r]) == length &&
+        strncmp(text, desyncRunnerNames[r], length) == 0)
+      side->runner = (DesyncRunner)r;
+  }
+  if (side->runner == DESYNC_RUNNER_COUNT)
+    return false;
+
+  side->kernel = getAabbKernel();
+  if (!colon)
+    return true;
+  for (int k = 0; k < AABB_KERNEL_COUNT; k++) {
+    if (strcmp(colon + 1, getAabbKernelName((AabbKernel)k)) == 0) {
+      side->kernel = (AabbKernel)k;
+      return isAabbKernelSupported(side->kernel);
+    }
+  }
+  return false;
+}
+
+/** @brief Starts the game of a side (same seed and level on both sides). */
+static bool startDesyncSide(DesyncSide *side, int level, uint64_t seed) {
+  side->batch = NULL;
+  side->fork = NULL;
+  initWorld(&side->world, GAME_WIDTH, GAME_HEIGHT, level, seed);
+  if (side->runner == DESYNC_RUNNER_BATCH) {
+    side->batch = createWorldBatch(1, GAME_WIDTH, GAME_HEIGHT, level, seed);
+    return side->batch != NULL;
+  }
+  if (side->runner == DESYNC_RUNNER_FORK) {
+    side->fork = createWorldFork(&side->world);
+    return side->fork != NULL;
+  }
+  return true;
+}
+
+static void stopDesyncSide(DesyncSide *side) {
+  destroyWorldBatch(side->batch);
+  destroyWorldFork(side->fork);
+}
+
+/**
+ * @brief Steps a side by one tick (a new game first if the last one
+ * ended), and leaves the resulting state in side->world.
+ */
+static bool stepDesyncSide(DesyncSide *side, WorldAction action, float dt) {
+  setAabbKernel(side->kernel);
+  bool over = side->world.state == STATE_GAME_OVER;
+
+  switch (side->runner) {
+  case DESYNC_RUNNER_WORLD:
+    if (over)
+      resetWorld(&side->world);
+    stepWorld(&side->world, action, dt);
+    break;
+  case DESYNC_RUNNER_BATCH:
+    if (over)
+      resetBatchWorld(side->batch, 0);
+    stepWorldBatch(side->batch, &action, dt, NULL);
+    storeBatchWorld(side->batch, 0, &side->world);
+    break;
+  case DESYNC_RUNNER_FORK:
+    if (over) {
+      // A new game: a new root
+      resetWorld(&side->world);
+      destroyWorldFork(side->fork);
+      side->fork = createWorldFork(&side->world);
+      if (!side->fork)
+        return false;
+    }
+    stepWorldFork(side->fork, action, dt);
+    materializeWorldFork(side->fork, &side->world);
+    break;
+  default:
+    return false;
+  }
+  return true;
+}
+
+/** @brief The inputs of both sides: random, and independent of the game. */
+static WorldAction nextDesyncAction(Rng *input) {
+  WorldAction action = {(Direction)((int)rngRange(input, 3) - 1),
+                        rngRange(input, 2) == 1};
+  return action;
+}
+
+/**
+ * @brief Starts `path desync --follow ...` on a socket: the peer plays
+ * side B with the same inputs in its own build.
+ * @return pid_t The peer, or -1 (its streams are left NULL).
+ */
+static pid_t startDesyncPeer(const char *path, const char *config,
+                             long frames, uint64_t seed, int level, float dt,
+                             FILE **in, FILE **out) {
+  char framesText[32], seedText[32], levelText[16], dtText[32];
+  snprintf(framesText, sizeof(framesText), "%ld", frames);
+  snprintf(seedText, sizeof(seedText), "%llu", (unsigned long long)seed);
+  snprintf(levelText, sizeof(levelText), "%d", level);
+  snprintf(dtText, sizeof(dtText), "%a", dt); // Exact: hexadecimal float
+
+  *in = *out = NULL;
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    return -1;
+
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    dup2(fds[1], STDIN_FILENO);
+    dup2(fds[1], STDOUT_FILENO);
+    close(fds[1]);
+    execl(path, path, "desync", "--follow", "--frames", framesText, "--seed",
+          seedText, "--level", levelText, "--dt", dtText, "--b", config,
+          (char *)NULL);
+    _exit(EXIT_FAILURE);
+  }
+  close(fds[1]);
+
+  *in = pid > 0 ? fdopen(fds[0], "rb") : NULL;
+  *out = *in ? fdopen(dup(fds[0]), "wb") : NULL;
+  if (!*in || !*out) {
+    if (*in)
+      fclose(*in);
+    else
+      close(fds[0]);
+    if (pid > 0)
+      waitpid(pid, NULL, 0);
+    return -1;
+  }
+  return pid;
+}
+
+/**
+ * @brief The peer side of `desync --peer`: plays side B, sends its hash
+ * after every tick on stdout and waits for a DESYNC_* command on stdin.
+ */
+static int followDesync(DesyncSide *side, long frames, uint64_t seed,
+                        float dt) {
+  Rng input;
+  seedRng(&input, seed);
+  for (long f = 0; f < frames; f++) {
+    if (!stepDesyncSide(side, nextDesyncAction(&input), dt))
+      return EXIT_FAILURE;
+
+    WorldHash hash;
+    hashWorldParts(&side->world, &hash);
+    if (fwrite(&hash, sizeof(hash), 1, stdout) != 1 || fflush(stdout) != 0)
+      return EXIT_FAILURE;
+
+    int command = getchar();
+    if (command == DESYNC_DUMP) {
+      WorldSnapshot snapshot;
+      worldSnapshot(&side->world, &snapshot);
+      fwrite(&snapshot, sizeof(snapshot), 1, stdout);
+      fflush(stdout);
+      return EXIT_SUCCESS;
+    }
+    if (command != DESYNC_CONTINUE)
+      break;
+  }
+  return EXIT_SUCCESS;
+}
+
+/** @brief Runs timed by measureDesyncHash() (the fastest one counts). */
+#define DESYNC_TIMING_RUNS 5
+
+/** @brief Time to play side A's game on its own, hashing each tick or not. */
+static double timeDesyncRun(const DesyncSide *config, long frames,
+                            int level, uint64_t seed, float dt, bool hash) {
+  World world;
+  initWorld(&world, GAME_WIDTH, GAME_HEIGHT, level, seed);
+  setAabbKernel(config->kernel);
+  Rng input;
+  seedRng(&input, seed);
+  volatile uint64_t sink = 0;
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (long f = 0; f < frames; f++) {
+    if (world.state == STATE_GAME_OVER)
+      resetWorld(&world);
+    stepWorld(&world, nextDesyncAction(&input), dt);
+    if (hash)
+      sink = hashWorld(&world);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  (void)sink;
+  return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Cost of the per-tick hash: the same game played with and without
+ * it, the runs interleaved so that both see the same machine load.
+ */
+static void measureDesyncHash(const DesyncSide *config, long frames,
+                              int level, uint64_t seed, float dt,
+                              double *stepNs, double *hashNs) {
+  double plain = 0, hashed = 0;
+  for (int run = 0; run < DESYNC_TIMING_RUNS; run++) {
+    double t = timeDesyncRun(config, frames, level, seed, dt, false);
+    plain = run == 0 || t < plain ? t : plain;
+    t = timeDesyncRun(config, frames, level, seed, dt, true);
+    hashed = run == 0 || t < hashed ? t : hashed;
+  }
+  *stepNs = plain * 1e9 / frames;
+  *hashNs = (hashed - plain) * 1e9 / frames;
+}
+
+/**
+ * @brief Plays the same game two ways, tick by tick, and reports the first
+ * tick where their states differ, with a field-level diff.
+ * Usage: spaceinvaders desync [--frames N] [--seed S] [--level L]
+ *                             [--dt SECONDS | --hz HZ] [--a CONFIG]
+ *                             [--b CONFIG] [--peer PATH]
+ * CONFIG is RUNNER[:KERNEL]: RUNNER is world, batch or fork, and KERNEL an
+ * AABB kernel (scalar, sse2, avx2, avx512; default: the widest supported).
+ * Side A defaults to world:scalar, side B to batch. With --peer, side B is
+ * played by another build of the program (PATH), in lockstep over a
+ * socket. Both sides play the same random inputs and restart a game
+ * whenever one ends. Exits with a failure status if they diverge.
+ */
+int runDesync(int argc, char *argv[]) {
+  long frames = DESYNC_FRAMES;
+  uint64_t seed = 1;
+  int level = 1;
+  float dt = FIXED_DT;
+  const char *configA = "world:scalar", *configB = "batch";
+  const char *peerPath = NULL;
+  bool follow = false;
+
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+      level = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--dt") == 0 && i + 1 < argc) {
+      dt = strtof(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--hz") == 0 && i + 1 < argc) {
+      dt = 1.0f / strtof(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--a") == 0 && i + 1 < argc) {
+      configA = argv[++i];
+    } else if (strcmp(argv[i], "--b") == 0 && i + 1 < argc) {
+      configB = argv[++i];
+    } else if (strcmp(argv[i], "--peer") == 0 && i + 1 < argc) {
+      peerPath = argv[++i];
+    } else if (strcmp(argv[i], "--follow") == 0) {
+      follow = true; // Internal: this process is the peer of --peer
+    } else {
+      fprintf(stderr,
+              "Usage: %s desync [--frames N] [--seed S] [--level L] "
+              "[--dt SECONDS | --hz HZ] [--a CONFIG] [--b CONFIG] "
+              "[--peer PATH]\n"
+              "CONFIG: world | batch | fork, optionally followed by "
+              ":scalar | :sse2 | :avx2 | :avx512\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  DesyncSide a, b;
+  if (frames <= 0 || level < 1 || level > LEVEL_COUNT || !(dt > 0) ||
+      !isfinite(dt) || !parseDesyncSide(configA, &a) ||
+      !parseDesyncSide(configB, &b)) {
+    fprintf(stderr,
+            "Invalid arguments: frames and dt must be > 0, level 1..%d, "
+            "configurations RUNNER[:KERNEL] (supported kernels only)\n",
+            LEVEL_COUNT);
+    return EXIT_FAILURE;
+  }
+
+  AabbKernel startKernel = getAabbKernel();
+  if (follow) {
+    int status = startDesyncSide(&b, level, seed)
+                     ? followDesync(&b, frames, seed, dt)
+                     : EXIT_FAILURE;
+    stopDesyncSide(&b);
+    return status;
+  }
+
+  FILE *peerIn = NULL, *peerOut = NULL;
+  pid_t peer = -1;
+  if (peerPath) {
+    peer = startDesyncPeer(peerPath, configB, frames, seed, level, dt,
+                           &peerIn, &peerOut);
+    if (peer < 0) {
+      fprintf(stderr, "Could not start '%s'\n", peerPath);
+      return EXIT_FAILURE;
+    }
+  }
+  if (!startDesyncSide(&a, level, seed) ||
+      (!peerPath && !startDesyncSide(&b, level, seed))) {
+    stopDesyncSide(&a);
+    if (!peerPath)
+      stopDesyncSide(&b);
+    return EXIT_FAILURE;
+  }
+
+  printf("Desync: %s (A) vs %s%s (B), %ld ticks (dt = %.4fs, seed = %llu, "
+         "level = %d)\n",
+         configA, configB, peerPath ? " in the peer build" : "", frames, dt,
+         (unsigned long long)seed, level);
+
+  // Lockstep: both sides play tick f, then their hashes are compared
+  Rng input;
+  seedRng(&input, seed);
+  WorldHash hashA, hashB;
+  WorldAction action = {MOVE_NONE, false};
+  bool lost = false;
+  long f = 0;
+  for (; f < frames; f++) {
+    action = nextDesyncAction(&input);
+    if (!stepDesyncSide(&a, action, dt)) {
+      lost = true;
+      break;
+    }
+    hashWorldParts(&a.world, &hashA);
+
+    if (peerPath) {
+      lost = fread(&hashB, sizeof(hashB), 1, peerIn) != 1;
+    } else {
+      lost = !stepDesyncSide(&b, action, dt);
+      if (!lost)
+        hashWorldParts(&b.world, &hashB);
+    }
+    if (lost || hashA.total != hashB.total)
+      break;
+
+    if (peerPath) {
+      fputc(f + 1 < frames ? DESYNC_CONTINUE : DESYNC_QUIT, peerOut);
+      fflush(peerOut);
+    }
+  }
+
+  int status = EXIT_SUCCESS;
+  if (lost) {
+    fprintf(stderr, "%s stopped at tick %ld\n",
+            peerPath ? "The peer" : "A runner", f);
+    status = EXIT_FAILURE;
+  } else if (f < frames) {
+    // B's state at this tick: already here, or sent by the peer
+    bool haveB = true;
+    if (peerPath) {
+      WorldSnapshot snapshot;
+      fputc(DESYNC_DUMP, peerOut);
+      fflush(peerOut);
+      haveB = fread(&snapshot, sizeof(snapshot), 1, peerIn) == 1 &&
+              worldRestore(&b.world, &snapshot);
+    }
+
+    printf("First divergence at tick %ld (%.2f s of play), input: move %d, "
+           "fire %d\n",
+           f, (f + 1) * dt, (int)action.move, (int)action.fire);
+    for (int p = 0; p < WORLD_PART_COUNT; p++) {
+      printf("  %-12s %016llx %s %016llx\n", getWorldPartName((WorldPart)p),
+             (unsigned long long)hashA.parts[p],
+             hashA.parts[p] == hashB.parts[p] ? "==" : "!=",
+             (unsigned long long)hashB.parts[p]);
+    }
+    if (haveB) {
+      printf("Fields (A != B):\n");
+      printWorldDiff(stdout, &a.world, &b.world, DESYNC_DIFF_LINES);
+    } else {
+      printf("The peer's World has another layout: no field diff\n");
+    }
+    status = EXIT_FAILURE;
+  } else {
+    printf("No divergence in %ld ticks, final hash %016llx\n", frames,
+           (unsigned long long)hashA.total);
+  }
+
+  if (peerPath) {
+    fclose(peerOut);
+    fclose(peerIn);
+    waitpid(peer, NULL, 0);
+  } else {
+    stopDesyncSide(&b);
+  }
+  stopDesyncSide(&a);
+
+  // Cost of the per-tick hash, on side A's game
+  if (status == EXIT_SUCCESS) {
+    double stepNs, hashNs;
+    measureDesyncHash(&a, frames, level, seed, dt, &stepNs, &hashNs);
+    printf("Hash: %.1f ns/tick (step: %.1f ns)\n", hashNs, stepNs);
+  }
+  setAabbKernel(startKernel);
+  return status;
 }
 
 // ==========================================
 //               ENTRY POINT
 // ==========================================
 int main(int argc, char *argv[]) {
-  srand((unsigned int)time(NULL));
-
-  if (argc > 1 && strcmp(argv[1], "ncurses") == 0) {
+  if (argc > 1 && strcmp(argv[1], "headless") == 0) {
+    return runHeadless(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "fork") == 0) {
+    return runForkBench(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "batch") == 0) {
+    return runBatchBench(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "threads") == 0) {
+    return runThreadsBench(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "server") == 0) {
+    return runServer(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "remote") == 0) {
+    return runRemote(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "aabb") == 0) {
+    return runAabbBench(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "hittest") == 0) {
+    return runHitTest(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "masktest") == 0) {
+    return runMaskTest(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "render") == 0) {
+    return runRenderBench(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "desync") == 0) {
+    return runDesync(argc, argv);
+  } else if (argc > 1 && strcmp(argv[1], "ncurses") == 0) {
+    LoopOptions options;
+    if (!parseLoopOptions(argc, argv, 2, &options))
+      return EXIT_FAILURE;
     printf("Mode: NCURSES\n");
-    runNcurses();
+    runNcurses(&options);
   } else {
+    // "sdl" is the default mode and may be omitted
+    int first = (argc > 1 && strcmp(argv[1], "sdl") == 0) ? 2 : 1;
+    LoopOptions options;
+    if (!parseLoopOptions(argc, argv, first, &options))
+      return EXIT_FAILURE;
     printf("Mode: SDL\n");
-    runSDL();
+    runSDL(&options);
   }
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/aabb_simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AABB_X86 1
+#include <immintrin.h>
+#else
+#define AABB_X86 0
+#endif
+
+/** @brief Signature shared by all kernels. */
+typedef uint32_t (*AabbOverlapFn)(Fixed x, Fixed y, Fixed w, Fixed h,
+                                  const Fixed *bx, const Fixed *by, Fixed bw,
+                                  Fixed bh, int count);
+
+// ==========================================
+//               SCALAR
+// ==========================================
+
+/** @brief checkOverlap() on boxes [first, count), one at a time. */
+static inline uint32_t overlapTail(Fixed x, Fixed y, Fixed right,
+                                   Fixed bottom, const Fixed *bx,
+                                   const Fixed *by, Fixed bw, Fixed bh,
+                                   int first, int count) {
+  uint32_t mask = 0;
+  for (int i = first; i < count; i++) {
+    // Bitwise ANDs: no branch per comparison
+    bool hit = (x < bx[i] + bw) & (right > bx[i]) & (y < by[i] + bh) &
+               (bottom > by[i]);
+    mask |= (uint32_t)hit << i;
+  }
+  return mask;
+}
+
+static uint32_t overlapBoxesScalar(Fixed x, Fixed y, Fixed w, Fixed h,
+                                   const Fixed *bx, const Fixed *by, Fixed bw,
+                                   Fixed bh, int count) {
+  return overlapTail(x, y, x + w, y + h, bx, by, bw, bh, 0, count);
+}
+
+#if AABB_X86
+
+// ==========================================
+//               SSE2 (4 boxes)
+// ==========================================
+
+/** @brief Boxes [i, i + 4) as 4 bits (lane k is box i + k). */
+__attribute__((target("sse2"))) static inline uint32_t
+overlap4(__m128i x, __m128i y, __m128i right, __m128i bottom, const Fixed *bx,
+         const Fixed *by, __m128i bw, __m128i bh, int i) {
+  __m128i ox = _mm_loadu_si128((const __m128i *)(bx + i));
+  __m128i oy = _mm_loadu_si128((const __m128i *)(by + i));
+  __m128i inX = _mm_and_si128(_mm_cmplt_epi32(x, _mm_add_epi32(ox, bw)),
+                              _mm_cmpgt_epi32(right, ox));
+  __m128i inY = _mm_and_si128(_mm_cmplt_epi32(y, _mm_add_epi32(oy, bh)),
+                              _mm_cmpgt_epi32(bottom, oy));
+  // One sign bit per lane
+  __m128i in = _mm_and_si128(inX, inY);
+  return (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(in)) << i;
+}
+
+__attribute__((target("sse2"))) static uint32_t
+overlapBoxesSse2(Fixed x, Fixed y, Fixed w, Fixed h, const Fixed *bx,
+                 const Fixed *by, Fixed bw, Fixed bh, int count) {
+  Fixed right = x + w, bottom = y + h;
+  __m128i vx = _mm_set1_epi32(x), vy = _mm_set1_epi32(y);
+  __m128i vr = _mm_set1_epi32(right), vb = _mm_set1_epi32(bottom);
+  __m128i vw = _mm_set1_epi32(bw), vh = _mm_set1_epi32(bh);
+
+  uint32_t mask = 0;
+  int i = 0;
+  for (; i + 4 <= count; i += 4)
+    mask |= overlap4(vx, vy, vr, vb, bx, by, vw, vh, i);
+  return mask | overlapTail(x, y, right, bottom, bx, by, bw, bh, i, count);
+}
+
+// ==========================================
+//               AVX2 (8 boxes)
+// ==========================================
+
+__attribute__((target("avx2"))) static uint32_t
+overlapBoxesAvx2(Fixed x, Fixed y, Fixed w, Fixed h, const Fixed *bx,
+                 const Fixed *by, Fixed bw, Fixed bh, int count) {
+  Fixed right = x + w, bottom = y + h;
+  __m256i vx = _mm256_set1_epi32(x), vy = _mm256_set1_epi32(y);
+  __m256i vr = _mm256_set1_epi32(right), vb = _mm256_set1_epi32(bottom);
+  __m256i vw = _mm256_set1_epi32(bw), vh = _mm256_set1_epi32(bh);
+
+  uint32_t mask = 0;
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i ox = _mm256_loadu_si256((const __m256i *)(bx + i));
+    __m256i oy = _mm256_loadu_si256((const __m256i *)(by + i));
+    // AVX2 only has "greater than": x < ox + bw is ox + bw > x
+    __m256i inX =
+        _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_add_epi32(ox, vw), vx),
+                         _mm256_cmpgt_epi32(vr, ox));
+    __m256i inY =
+        _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_add_epi32(oy, vh), vy),
+                         _mm256_cmpgt_epi32(vb, oy));
+    __m256i in = _mm256_and_si256(inX, inY);
+    mask |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(in)) << i;
+  }
+
+  // A last group of 4 (e.g., the 4 bunkers) still avoids the scalar loop
+  if (i + 4 <= count) {
+    mask |= overlap4(_mm256_castsi256_si128(vx), _mm256_castsi256_si128(vy),
+                     _mm256_castsi256_si128(vr), _mm256_castsi256_si128(vb),
+                     bx, by, _mm256_castsi256_si128(vw),
+                     _mm256_castsi256_si128(vh), i);
+    i += 4;
+  }
+  return mask | overlapTail(x, y, right, bottom, bx, by, bw, bh, i, count);
+}
+
+// ==========================================
+//               AVX-512 (16 boxes)
+// ==========================================
+
+__attribute__((target("avx512f"))) static uint32_t
+overlapBoxesAvx512(Fixed x, Fixed y, Fixed w, Fixed h, const Fixed *bx,
+                   const Fixed *by, Fixed bw, Fixed bh, int count) {
+  __m512i vx = _mm512_set1_epi32(x), vy = _mm512_set1_epi32(y);
+  __m512i vr = _mm512_set1_epi32(x + w), vb = _mm512_set1_epi32(y + h);
+  __m512i vw = _mm512_set1_epi32(bw), vh = _mm512_set1_epi32(bh);
+
+  // Masked loads: the last group needs no scalar tail
+  uint32_t mask = 0;
+  for (int i = 0; i < count; i += 16) {
+    __mmask16 lanes = count - i >= 16 ? 0xFFFF : (1u << (count - i)) - 1u;
+    __m512i ox = _mm512_maskz_loadu_epi32(lanes, bx + i);
+    __m512i oy = _mm512_maskz_loadu_epi32(lanes, by + i);
+    __mmask16 hit =
+        _mm512_mask_cmplt_epi32_mask(lanes, vx, _mm512_add_epi32(ox, vw));
+    hit = _mm512_mask_cmpgt_epi32_mask(hit, vr, ox);
+    hit = _mm512_mask_cmplt_epi32_mask(hit, vy, _mm512_add_epi32(oy, vh));
+    hit = _mm512_mask_cmpgt_epi32_mask(hit, vb, oy);
+    mask |= (uint32_t)hit << i;
+  }
+  return mask;
+}
+
+#endif // AABB_X86
+
+// ==========================================
+//               DISPATCH
+// ==========================================
+
+static const AabbOverlapFn kernels[AABB_KERNEL_COUNT] = {
+    overlapBoxesScalar,
+#if AABB_X86
+    overlapBoxesSse2,
+    overlapBoxesAvx2,
+    overlapBoxesAvx512,
+#endif
+};
+
+static const char *const kernelNames[AABB_KERNEL_COUNT] = {"scalar", "sse2",
+                                                           "avx2", "avx512"};
+
+/** @brief Kernel in use: scalar until selectAabbKernel() has run. */
+static AabbKernel currentKernel = AABB_KERNEL_SCALAR;
+static AabbOverlapFn overlapKernel = overlapBoxesScalar;
+
+bool isAabbKernelSupported(AabbKernel kernel) {
+  switch (kernel) {
+  case AABB_KERNEL_SCALAR:
+    return true;
+#if AABB_X86
+  // __builtin_cpu_supports() reads cpuid, and checks that the OS saves the
+  // AVX / AVX-512 registers (xgetbv)
+  case AABB_KERNEL_SSE2:
+    return __builtin_cpu_supports("sse2");
+  case AABB_KERNEL_AVX2:
+    return __builtin_cpu_supports("avx2");
+  case AABB_KERNEL_AVX512:
+    return __builtin_cpu_supports("avx512f");
+#endif
+  default:
+    return false;
+  }
+}
+
+/** @brief Picks the widest supported kernel when the program starts. */
+__attribute__((constructor)) static void selectAabbKernel(void) {
+#if AABB_X86
+  __builtin_cpu_init();
+#endif
+  for (int k = AABB_KERNEL_COUNT - 1; k >= 0; k--) {
+    if (setAabbKernel((AabbKernel)k))
+      return;
+  }
+}
+
+AabbKernel getAabbKernel(void) { return currentKernel; }
+
+bool setAabbKernel(AabbKernel kernel) {
+  if (kernel < 0 || kernel >= AABB_KERNEL_COUNT ||
+      !isAabbKernelSupported(kernel))
+    return false;
+
+  currentKernel = kernel;
+  overlapKernel = kernels[kernel];
+  return true;
+}
+
+const char *getAabbKernelName(AabbKernel kernel) {
+  if (kernel < 0 || kernel >= AABB_KERNEL_COUNT)
+    return "?";
+  return kernelNames[kernel];
+}
+
+uint32_t overlapBoxes(Fixed x, Fixed y, Fixed w, Fixed h, const Fixed *bx,
+                      const Fixed *by, Fixed bw, Fixed bh, int count) {
+  return overlapKernel(x, y, w, h, bx, by, bw, bh, count);
+}
@@ -1,50 +1,84 @@
+#include "../../includes/sim_float.h"
 #include "../../includes/bunker.h"
+#include "../../includes/aabb_simd.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /**
- * @brief Helper function for AABB (Axis-Aligned Bounding Box) collision.
- * Checks if two rectangles overlap.
+ * @brief The classic shape, one mask of blocks per row (bit = column):
+ * - the top corners are cut (rounding the top edge),
+ * - the bottom arch is cut (columns 3 to 6 of rows 5 to 7).
  */
-bool checkBlockOverlap(float bx, float by, float bw, float bh, float ox,
-                       float oy, float ow, float oh) {
-  return (bx < ox + ow && bx + bw > ox && by < oy + oh && by + bh > oy);
-}
+#define BUNKER_FULL_ROW ((1u << BUNKER_COLS) - 1u)
+#define BUNKER_TOP_ROW (BUNKER_FULL_ROW & ~(1u | 1u << (BUNKER_COLS - 1)))
+#define BUNKER_ARCH_ROW (BUNKER_FULL_ROW & ~0x78u)
+
+static const uint16_t bunkerShape[BUNKER_ROWS] = {
+    BUNKER_TOP_ROW,  BUNKER_FULL_ROW, BUNKER_FULL_ROW, BUNKER_FULL_ROW,
+    BUNKER_FULL_ROW, BUNKER_ARCH_ROW, BUNKER_ARCH_ROW, BUNKER_ARCH_ROW};
 
 /**
- * @brief Initializes the grid of blocks for a single bunker.
- * "Sculpts" the classic shape by deactivating specific blocks in the grid.
+ * @brief Pixels blasted by one impact (bit = column, left to right): a
+ * ragged blob, denser in the middle, as in the arcade original.
  */
-void initBunkerShape(Bunker *b, float startX, float startY) {
-  if (!b)
-    return;
+static const uint8_t craterMask[BUNKER_CRATER_SIZE] = {
+    0x91, /* X...X..X */
+    0x44, /* ..X...X. */
+    0x7E, /* .XXXXXX. */
+    0xFF, /* XXXXXXXX */
+    0xFF, /* XXXXXXXX */
+    0x7E, /* .XXXXXX. */
+    0x24, /* ..X..X.. */
+    0x89, /* X..X...X */
+};
 
-  b->x = startX;
-  b->y = startY;
+/** @brief hashBunkerPixels() of an intact bunker (set when starting). */
+static uint64_t intactHash;
 
-  int i = 0;
-  for (int row = 0; row < BUNKER_ROWS; row++) {
-    for (int col = 0; col < BUNKER_COLS; col++) {
-      // Position each block relative to the bunker's start (Top-Left)
-      b->blocks[i].x = startX + col * BLOCK_SIZE;
-      b->blocks[i].y = startY + row * BLOCK_SIZE;
-      b->blocks[i].active = true;
+/** @brief Zobrist key of pixel (px, py): SplitMix64 of its index. */
+static inline uint64_t getPixelKey(int px, int py) {
+  uint64_t z = (uint64_t)(py * BUNKER_PIXEL_WIDTH + px + 1) *
+               0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
 
-      // --- Shape Sculpting Logic ---
+/**
+ * @brief Fills the bitmap with the classic shape, each block expanded to
+ * BLOCK_PIXELS x BLOCK_PIXELS intact pixels.
+ */
+static void fillBunkerShape(Bunker *b) {
+  for (int row = 0; row < BUNKER_ROWS; row++) {
+    BunkerRow line[BUNKER_ROW_WORDS] = {0};
+    for (int px = 0; px < BUNKER_PIXEL_WIDTH; px++) {
+      if (bunkerShape[row] & (1u << (px / BLOCK_PIXELS)))
+        line[px / BUNKER_WORD_BITS] |= (BunkerRow)(1u << px % BUNKER_WORD_BITS);
+    }
+    for (int py = 0; py < BLOCK_PIXELS; py++)
+      memcpy(b->pixels[row * BLOCK_PIXELS + py], line, sizeof(line));
+  }
+}
 
-      // Cut out the bottom arch (middle columns of the bottom rows)
-      if (row >= 5 && (col >= 3 && col <= 6)) {
-        b->blocks[i].active = false;
-      }
+/** @brief Hashes the intact shape once, when the program starts. */
+__attribute__((constructor)) static void hashIntactBunker(void) {
+  Bunker b;
+  fillBunkerShape(&b);
+  intactHash = hashBunkerPixels(&b);
+}
 
-      // Cut out the top corners (rounding the top edge)
-      if (row == 0 && (col == 0 || col == BUNKER_COLS - 1)) {
-        b->blocks[i].active = false;
-      }
+/**
+ * @brief Initializes a single bunker: origin plus the classic shape.
+ */
+void initBunkerShape(Bunker *b, Fixed startX, Fixed startY) {
+  if (!b)
+    return;
 
-      i++;
-    }
-  }
+  b->x = startX;
+  b->y = startY;
+  fillBunkerShape(b);
+  b->hash = intactHash;
 }
 
 BunkerManager *createBunkers(unsigned screenWidth) {
@@ -64,15 +98,15 @@ void resetBunkers(BunkerManager *bm, unsigned screenWidth) {
     return;
 
   // Calculate layout to center bunkers evenly
-  float bunkerWidth = BUNKER_COLS * BLOCK_SIZE;
-  float totalWidth = BUNKER_COUNT * bunkerWidth;
+  Fixed bunkerWidth = FIXED(BUNKER_PIXEL_WIDTH);
+  Fixed totalWidth = BUNKER_COUNT * bunkerWidth;
 
   // Distribute the empty space equally between bunkers and screen edges
-  float gap = (screenWidth - totalWidth) / (BUNKER_COUNT + 1);
-  float yPos = 450.0f; // Fixed vertical height for shields
+  Fixed gap = (FIXED(screenWidth) - totalWidth) / (BUNKER_COUNT + 1);
+  Fixed yPos = FIXED(450); // Fixed vertical height for shields
 
   for (int i = 0; i < BUNKER_COUNT; i++) {
-    float xPos = gap + (i * (bunkerWidth + gap));
+    Fixed xPos = gap + (i * (bunkerWidth + gap));
     initBunkerShape(&bm->bunkers[i], xPos, yPos);
   }
 }
@@ -82,31 +116,179 @@ void destroyBunkers(BunkerManager *bm) {
     free(bm);
 }
 
-bool checkBunkerCollision(BunkerManager *bm, Projectile *p) {
-  if (!bm || !p || !p->active)
-    return false;
+static inline int clampInt(int v, int lo, int hi) {
+  return v < lo ? lo : (v > hi ? hi : v);
+}
 
-  // Check every bunker
-  for (int i = 0; i < BUNKER_COUNT; i++) {
-    Bunker *b = &bm->bunkers[i];
+uint64_t hashBunkerPixels(const Bunker *b) {
+  uint64_t hash = 0;
+  for (int py = 0; py < BUNKER_PIXEL_HEIGHT; py++) {
+    for (int w = 0; w < BUNKER_ROW_WORDS; w++) {
+      for (unsigned bits = b->pixels[py][w]; bits; bits &= bits - 1)
+        hash ^= getPixelKey(w * BUNKER_WORD_BITS + __builtin_ctz(bits), py);
+    }
+  }
+  return hash;
+}
+
+bool isBunkerPixelSet(const Bunker *b, int px, int py) {
+  return (b->pixels[py][px / BUNKER_WORD_BITS] >> (px % BUNKER_WORD_BITS)) &
+         1u;
+}
+
+/** @brief Bits of word `w` that fall in the pixel range [x0, x1). */
+static inline unsigned wordMask(int w, int x0, int x1) {
+  int from = x0 - w * BUNKER_WORD_BITS;
+  int to = x1 - w * BUNKER_WORD_BITS;
+  unsigned mask = to >= BUNKER_WORD_BITS ? 0xFFFFu : (1u << to) - 1u;
+  if (from > 0)
+    mask &= ~((1u << from) - 1u);
+  return mask;
+}
 
-    // Check every block in the bunker
-    for (int j = 0; j < BUNKER_ROWS * BUNKER_COLS; j++) {
-      BunkerBlock *block = &b->blocks[j];
+/** @brief Any intact pixel in [x0, x1) of one row (bounds inside). */
+static bool testRowPixels(const BunkerRow *row, int x0, int x1) {
+  for (int w = x0 / BUNKER_WORD_BITS; w * BUNKER_WORD_BITS < x1; w++) {
+    if (row[w] & wordMask(w, x0, x1))
+      return true;
+  }
+  return false;
+}
 
-      // Only check collision if the block is still part of the shield
-      if (block->active &&
-          checkBlockOverlap(block->x, block->y, BLOCK_SIZE, BLOCK_SIZE, p->x,
-                            p->y, p->w, p->h)) {
+int countBunkerPixels(const Bunker *b, int x0, int y0, int x1, int y1) {
+  x0 = clampInt(x0, 0, BUNKER_PIXEL_WIDTH);
+  x1 = clampInt(x1, 0, BUNKER_PIXEL_WIDTH);
+  y0 = clampInt(y0, 0, BUNKER_PIXEL_HEIGHT);
+  y1 = clampInt(y1, 0, BUNKER_PIXEL_HEIGHT);
 
-        // Destroy the block (erode the shield)
-        block->active = false;
+  int count = 0;
+  for (int py = y0; py < y1 && x0 < x1; py++) {
+    for (int w = x0 / BUNKER_WORD_BITS; w * BUNKER_WORD_BITS < x1; w++)
+      count += __builtin_popcount(b->pixels[py][w] & wordMask(w, x0, x1));
+  }
+  return count;
+}
 
-        // Destroy the projectile
-        p->active = false;
-        return true;
+void blastBunkerCrater(Bunker *b, int cx, int cy) {
+  int left = cx - BUNKER_CRATER_SIZE / 2;
+  int top = cy - BUNKER_CRATER_SIZE / 2;
+  for (int r = 0; r < BUNKER_CRATER_SIZE; r++) {
+    int py = top + r;
+    if (py < 0 || py >= BUNKER_PIXEL_HEIGHT)
+      continue;
+    for (unsigned bits = craterMask[r]; bits; bits &= bits - 1) {
+      int px = left + __builtin_ctz(bits);
+      if (px < 0 || px >= BUNKER_PIXEL_WIDTH)
+        continue;
+      BunkerRow *word = &b->pixels[py][px / BUNKER_WORD_BITS];
+      BunkerRow bit = (BunkerRow)(1u << px % BUNKER_WORD_BITS);
+      if (*word & bit) { // Only an intact pixel has its key in the hash
+        *word &= (BunkerRow)~bit;
+        b->hash ^= getPixelKey(px, py);
       }
     }
   }
+}
+
+/**
+ * @brief The static test on the box (left, top, w, h), given relative to
+ * the bunker: leading intact row under it (the lowest one if `up`).
+ */
+static bool findBunkerRow(const Bunker *b, Fixed left, Fixed top, Fixed w,
+                          Fixed h, bool up, int *row) {
+  // Pixels under the box: pixel k covers [k, k + 1)
+  int x0 = clampInt(fixedFloor(left), 0, BUNKER_PIXEL_WIDTH);
+  int x1 = clampInt(fixedCeil(left + w), 0, BUNKER_PIXEL_WIDTH);
+  int y0 = clampInt(fixedFloor(top), 0, BUNKER_PIXEL_HEIGHT);
+  int y1 = clampInt(fixedCeil(top + h), 0, BUNKER_PIXEL_HEIGHT);
+  if (x0 >= x1 || y0 >= y1)
+    return false;
+
+  // The leading edge meets the bunker first
+  for (int k = 0; k < y1 - y0; k++) {
+    int py = up ? y1 - 1 - k : y0 + k;
+    if (testRowPixels(b->pixels[py], x0, x1)) {
+      *row = py;
+      return true;
+    }
+  }
   return false;
-}
\ No newline at end of file
+}
+
+/** @brief sweepBunkers() on one bunker the path may reach. */
+static bool sweepBunker(const Bunker *b, Fixed x0, Fixed y0, Fixed x1,
+                        Fixed y1, Fixed w, Fixed h, bool up, Fixed *toi,
+                        int *cx, int *cy) {
+  int row;
+  Fixed dx = x1 - x0, dy = y1 - y0;
+  Fixed spanX = dx < 0 ? -dx : dx, spanY = dy < 0 ? -dy : dy;
+  Fixed top0 = y0 - b->y, top1 = y1 - b->y;
+  if (dx == 0) {
+    // Vertical path: the rows are met in order, so the leading intact row
+    // of the swept box is the impact. It is hit when the leading edge of
+    // the box enters it (at once if the start box already covers it).
+    Fixed top = dy < 0 ? top1 : top0;
+    if (!findBunkerRow(b, x0 - b->x, top, w, spanY + h, up, &row))
+      return false;
+
+    Fixed t = 0;
+    if (up && row < fixedFloor(top0))
+      t = (Fixed)fixedDiv(top0 - FIXED(row + 1), top0 - top1);
+    else if (!up && row >= fixedCeil(top0 + h))
+      t = (Fixed)fixedDiv(FIXED(row) - (top0 + h), top1 - top0);
+    *toi = t;
+    *cx = fixedFloor(x0 - b->x + w / 2);
+    *cy = row;
+    return true;
+  }
+
+  // Other paths: sub-steps of at most one pixel, so that no row or column
+  // of pixels is skipped
+  int steps = fixedCeil(spanX > spanY ? spanX : spanY);
+  for (int k = 0; k <= steps; k++) {
+    Fixed t = k == steps ? FIXED_ONE : FIXED(k) / steps;
+    Fixed left = (k == steps ? x1 : x0 + fixedMul(dx, t)) - b->x;
+    Fixed top = k == steps ? top1 : top0 + fixedMul(dy, t);
+    if (!findBunkerRow(b, left, top, w, h, up, &row))
+      continue;
+
+    *toi = t;
+    *cx = fixedFloor(left + w / 2);
+    *cy = row;
+    return true;
+  }
+  return false;
+}
+
+int sweepBunkers(const BunkerManager *bm, Fixed x0, Fixed y0, Fixed x1,
+                 Fixed y1, Fixed w, Fixed h, bool up, Fixed *toi, int *cx,
+                 int *cy) {
+  // Box bounding the whole path, tested against all bunkers at once
+  Fixed sx = x0 < x1 ? x0 : x1;
+  Fixed sy = y0 < y1 ? y0 : y1;
+  Fixed sw = (x0 < x1 ? x1 - x0 : x0 - x1) + w;
+  Fixed sh = (y0 < y1 ? y1 - y0 : y0 - y1) + h;
+  Fixed bx[BUNKER_COUNT], by[BUNKER_COUNT];
+  for (int i = 0; i < BUNKER_COUNT; i++) {
+    bx[i] = bm->bunkers[i].x;
+    by[i] = bm->bunkers[i].y;
+  }
+  uint32_t near =
+      overlapBoxes(sx, sy, sw, sh, bx, by, FIXED(BUNKER_PIXEL_WIDTH),
+                   FIXED(BUNKER_PIXEL_HEIGHT), BUNKER_COUNT);
+
+  int hit = -1;
+  for (; near; near &= near - 1) {
+    int i = __builtin_ctz(near);
+    Fixed t;
+    int x, y;
+    if (sweepBunker(&bm->bunkers[i], x0, y0, x1, y1, w, h, up, &t, &x, &y) &&
+        (hit < 0 || t < *toi)) {
+      hit = i;
+      *toi = t;
+      *cx = x;
+      *cy = y;
+    }
+  }
+  return hit;
+}
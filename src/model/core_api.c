@@ -0,0 +1,144 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/spaceinvaders_core.h"
+#include "../../includes/raster.h"
+#include "../../includes/world.h"
+#include <stdlib.h>
+#include <string.h>
+
+// The public constants mirror the Model ones
+_Static_assert(SI_MAX_ENEMIES == TOTAL_ENEMIES, "SI_MAX_ENEMIES out of date");
+_Static_assert(SI_MAX_BULLETS == MAX_PROJECTILES, "SI_MAX_BULLETS out of date");
+_Static_assert((unsigned)SI_EVENT_ENEMY_SHOOT == WORLD_EVENT_ENEMY_SHOOT &&
+                   (unsigned)SI_EVENT_ENEMY_HIT == WORLD_EVENT_ENEMY_HIT &&
+                   (unsigned)SI_EVENT_PLAYER_DIED == WORLD_EVENT_PLAYER_DIED &&
+                   (unsigned)SI_EVENT_LEVEL_CHANGE ==
+                       WORLD_EVENT_LEVEL_CHANGE &&
+                   (unsigned)SI_EVENT_GAME_WON == WORLD_EVENT_GAME_WON,
+               "SI_EVENT_* must match WorldEvent");
+
+struct SiEnv {
+  World world;
+  uint64_t frame; /**< Ticks since the last reset. */
+};
+
+struct SiRenderer {
+  Rasterizer *raster;
+};
+
+uint32_t siApiVersion(void) { return SI_API_VERSION; }
+
+SiEnv *siCreate(uint32_t screenWidth, uint32_t screenHeight, int32_t level,
+                uint64_t seed) {
+  if (screenWidth == 0 || screenHeight == 0 || level < 1 ||
+      level > LEVEL_COUNT)
+    return NULL;
+
+  SiEnv *env = (SiEnv *)calloc(1, sizeof(SiEnv));
+  if (!env)
+    return NULL;
+
+  initWorld(&env->world, screenWidth, screenHeight, level, seed);
+  return env;
+}
+
+void siReset(SiEnv *env, uint64_t seed) {
+  if (!env)
+    return;
+
+  // Rebuild from scratch so that the high score does not leak between runs
+  initWorld(&env->world, env->world.screenWidth, env->world.screenHeight,
+            env->world.startLevel, seed);
+  env->frame = 0;
+}
+
+uint32_t siStep(SiEnv *env, SiAction action) {
+  if (!env || env->world.state != STATE_PLAYING)
+    return 0;
+
+  WorldAction input = {MOVE_NONE, action.fire != 0};
+  if (action.move == SI_MOVE_LEFT)
+    input.move = MOVE_LEFT;
+  else if (action.move == SI_MOVE_RIGHT)
+    input.move = MOVE_RIGHT;
+
+  env->frame++;
+  return stepWorld(&env->world, input, SI_TICK_SECONDS);
+}
+
+void siObserve(const SiEnv *env, SiObservation *out) {
+  if (!env || !out)
+    return;
+
+  const World *w = &env->world;
+  memset(out, 0, sizeof(SiObservation));
+
+  out->frame = env->frame;
+  if (w->state == STATE_GAME_OVER)
+    out->status = w->playerWon ? SI_STATUS_WON : SI_STATUS_LOST;
+  else
+    out->status = SI_STATUS_PLAYING;
+  out->level = w->currentLevel;
+  out->score = w->player.score;
+  out->health = w->player.health;
+
+  out->playerX = fixedToFloat(w->player.x);
+  out->playerY = fixedToFloat(w->player.y);
+  out->playerWidth = (float)w->player.width;
+  out->playerHeight = (float)w->player.height;
+
+  out->bossActive = w->swarm.kind == SWARM_BOSS && w->swarm.boss.active;
+  out->bossHealth = w->swarm.boss.health;
+  out->bossX = fixedToFloat(w->swarm.boss.x);
+  out->bossY = fixedToFloat(w->swarm.boss.y);
+
+  for (int i = 0; i < SI_MAX_ENEMIES; i++) {
+    out->enemyAlive[i] = w->swarm.enemies[i].active;
+    out->enemyX[i] = fixedToFloat(getEnemyX(&w->swarm, i));
+    out->enemyY[i] = fixedToFloat(getEnemyY(&w->swarm, i));
+  }
+
+  // Live bullets are packed in [0, count)
+  const Projectiles *p = &w->projectiles;
+  for (int i = 0; i < SI_MAX_BULLETS; i++) {
+    out->bulletActive[i] = (unsigned)i < p->count;
+    if (!out->bulletActive[i])
+      continue;
+    out->bulletX[i] = fixedToFloat(p->x[i]);
+    out->bulletY[i] = fixedToFloat(p->y[i]);
+    out->bulletVelocityY[i] = fixedToFloat(p->velocityY[i]);
+  }
+}
+
+void siDestroy(SiEnv *env) { free(env); }
+
+SiRenderer *siCreateRenderer(uint32_t width, uint32_t height,
+                             uint32_t channels, uint32_t screenWidth,
+                             uint32_t screenHeight) {
+  if (channels != RASTER_GRAY && channels != RASTER_RGB)
+    return NULL;
+
+  SiRenderer *renderer = (SiRenderer *)calloc(1, sizeof(SiRenderer));
+  if (!renderer)
+    return NULL;
+
+  renderer->raster = createRasterizer(width, height, (RasterFormat)channels,
+                                      screenWidth, screenHeight);
+  if (!renderer->raster) {
+    free(renderer);
+    return NULL;
+  }
+  return renderer;
+}
+
+void siRender(SiRenderer *renderer, const SiEnv *env, uint8_t *pixels) {
+  if (!renderer || !env)
+    return;
+  rasterizeWorld(renderer->raster, pixels, &env->world);
+}
+
+void siDestroyRenderer(SiRenderer *renderer) {
+  if (!renderer)
+    return;
+  destroyRasterizer(renderer->raster);
+  free(renderer);
+}
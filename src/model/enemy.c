@@ -1,66 +1,124 @@
+#include "../../includes/sim_float.h"
 #include "../../includes/enemy.h"
 #include <math.h>
 #include <stdlib.h>
-#include <time.h>
+#include <string.h>
 
 Swarm *createSwarm(int level) {
   Swarm *s = (Swarm *)calloc(1, sizeof(Swarm));
   if (!s)
     return NULL;
 
+  initSwarm(s, level, 0);
+  return s;
+}
+
+void initSwarm(Swarm *s, int level, TimerTime now) {
+  if (!s)
+    return;
+
+  // Same starting point as a freshly calloc'ed Swarm
+  memset(s, 0, sizeof(Swarm));
+
   s->level = level;
-  s->shootTimer = 0.0f;
-
-  // --- LEVEL 1: STANDARD SWARM ---
-  if (level == 1) {
-    s->direction = 1; // Start moving Right
-
-    // Initialize Difficulty Timers
-    s->moveTimer = 0.0f;
-    s->moveInterval = MAX_MOVE_INTERVAL; // Start slow
-    s->shootCooldown = MAX_SHOOT_COOLDOWN;
-    s->animationFrame = false;
-    s->aliveCount = TOTAL_ENEMIES;
-
-    // Ensure Boss is disabled for Level 1
-    s->boss.active = false;
-
-    // Grid Generation Loop
-    int index = 0;
-    for (int row = 0; row < ENEMY_ROWS; row++) {
-      for (int col = 0; col < ENEMY_COLS; col++) {
-        // Calculate grid position with padding
-        float x = ENEMY_START_X + col * (ENEMY_WIDTH + ENEMY_PADDING);
-        float y = ENEMY_START_Y + row * (ENEMY_HEIGHT + ENEMY_PADDING);
-
-        s->enemies[index].x = x;
-        s->enemies[index].y = y;
-        s->enemies[index].width = ENEMY_WIDTH;
-        s->enemies[index].height = ENEMY_HEIGHT;
-        s->enemies[index].active = true;
-        s->enemies[index].killScore = ENEMY_KILL_SCORE;
-        index++;
-      }
-    }
-  }
-  // --- LEVEL 2: BOSS BATTLE ---
-  else if (level == 2) {
-    // Disable all standard swarm enemies
-    for (int i = 0; i < TOTAL_ENEMIES; i++)
-      s->enemies[i].active = false;
-
-    // Initialize Boss Entity
-    s->boss.active = true;
-    s->boss.width = 64.0f;
-    s->boss.height = 64.0f;
-    s->boss.x = 400.0f - 32.0f; // Start Center
-    s->boss.y = 80.0f;          // Start Top
-    s->boss.health = 20;        // HP
-    s->boss.maxHealth = 20;
-    s->boss.direction = 1;   // Moving Right
-    s->shootCooldown = 0.5f; // Boss shoots faster and consistently
+  s->kind = getLevelKind(level);
+  s->shootAt = now;
+  s->lastMoveAt = now;
+  seedRng(&s->rng, SWARM_DEFAULT_SEED);
+
+  getSwarmBehavior(s->kind)->init(s);
+}
+
+void seedSwarm(Swarm *swarm, uint64_t seed) {
+  if (swarm)
+    seedRng(&swarm->rng, seed);
+}
+
+// ==========================================
+//               ALIVE MASKS
+// ==========================================
+
+/** @brief Zobrist key of enemies[index]: SplitMix64 of its index. */
+static inline uint64_t getEnemyKey(int index) {
+  uint64_t z = (uint64_t)(index + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+uint64_t hashSwarmEnemies(const Swarm *swarm) {
+  uint64_t hash = 0;
+  for (int j = 0; j < TOTAL_ENEMIES; j++) {
+    if (swarm->enemies[j].active)
+      hash ^= getEnemyKey(j);
   }
-  return s;
+  return hash;
+}
+
+void fillSwarmAlive(SwarmAlive *alive) {
+  for (int row = 0; row < ENEMY_ROWS; row++)
+    alive->rows[row] = (uint16_t)((1u << ENEMY_COLS) - 1u);
+  for (int col = 0; col < ENEMY_COLS; col++)
+    alive->cols[col] = (uint8_t)((1u << ENEMY_ROWS) - 1u);
+}
+
+void clearSwarmAlive(SwarmAlive *alive, int index) {
+  int row = index / ENEMY_COLS;
+  int col = index % ENEMY_COLS;
+  alive->rows[row] &= (uint16_t)~(1u << col);
+  alive->cols[col] &= (uint8_t)~(1u << row);
+}
+
+unsigned countSwarmAlive(const SwarmAlive *alive) {
+  unsigned count = 0;
+  for (int row = 0; row < ENEMY_ROWS; row++)
+    count += (unsigned)__builtin_popcount(alive->rows[row]);
+  return count;
+}
+
+bool getSwarmEdges(const SwarmAlive *alive, Fixed originX, Fixed *left,
+                   Fixed *right) {
+  unsigned columns = 0;
+  for (int row = 0; row < ENEMY_ROWS; row++)
+    columns |= alive->rows[row];
+  if (!columns)
+    return false;
+
+  int first = __builtin_ctz(columns);
+  int last = 31 - __builtin_clz(columns);
+  *left = originX + FIXED(first * ENEMY_PITCH_X);
+  *right = originX + FIXED(last * ENEMY_PITCH_X + ENEMY_WIDTH);
+  return true;
+}
+
+int pickSwarmShooter(const SwarmAlive *alive, int startCol) {
+  unsigned columns = 0;
+  for (int row = 0; row < ENEMY_ROWS; row++)
+    columns |= alive->rows[row];
+  if (!columns)
+    return -1;
+
+  // First non-empty column at or after startCol, else wrap to the lowest
+  unsigned after = columns >> startCol;
+  int col = after ? startCol + __builtin_ctz(after) : __builtin_ctz(columns);
+  int row = 31 - __builtin_clz(alive->cols[col]); // Bottom-most
+  return row * ENEMY_COLS + col;
+}
+
+Fixed getEnemyX(const Swarm *swarm, int index) {
+  return swarm->originX + FIXED((index % ENEMY_COLS) * ENEMY_PITCH_X);
+}
+
+Fixed getEnemyY(const Swarm *swarm, int index) {
+  return swarm->originY + FIXED((index / ENEMY_COLS) * ENEMY_PITCH_Y);
+}
+
+void killSwarmEnemy(Swarm *swarm, int index) {
+  if (swarm->enemies[index].active)
+    swarm->enemyHash ^= getEnemyKey(index);
+  swarm->enemies[index].active = false;
+  clearSwarmAlive(&swarm->alive, index);
+  updateSwarmSpeed(swarm);
 }
 
 void destroySwarm(Swarm *swarm) {
@@ -69,169 +127,242 @@ void destroySwarm(Swarm *swarm) {
   }
 }
 
+TimerTime getSwarmInterval(float fastest, float slowest,
+                           unsigned aliveCount) {
+  // Lerp (Linear Interpolation) on whole ticks, by the ratio
+  // aliveCount / TOTAL_ENEMIES: 1 (Full Swarm) -> near 0 (One Enemy Left)
+  TimerTime from = secondsToTimer(fastest);
+  TimerTime to = secondsToTimer(slowest);
+  return from + (to - from) * aliveCount / TOTAL_ENEMIES;
+}
+
 /**
  * @brief Recalculates swarm speed based on remaining enemies.
  * Linearly interpolates between MAX_MOVE_INTERVAL (slow) and MIN_MOVE_INTERVAL
  * (fast).
  */
 void updateSwarmSpeed(Swarm *swarm) {
-  unsigned count = 0;
-  for (int i = 0; i < TOTAL_ENEMIES; i++) {
-    if (swarm->enemies[i].active)
-      count++;
-  }
+  unsigned count = countSwarmAlive(&swarm->alive);
   swarm->aliveCount = count;
 
-  // Ratio: 1.0 (Full Swarm) -> near 0.0 (One Enemy Left)
-  float ratio = (float)count / (float)TOTAL_ENEMIES;
-
-  // Lerp (Linear Interpolation) Formula
   swarm->moveInterval =
-      MIN_MOVE_INTERVAL + (MAX_MOVE_INTERVAL - MIN_MOVE_INTERVAL) * ratio;
+      getSwarmInterval(MIN_MOVE_INTERVAL, MAX_MOVE_INTERVAL, count);
 
   // Also speed up shooting rate
   swarm->shootCooldown =
-      MIN_SHOOT_COOLDOWN + (MAX_SHOOT_COOLDOWN - MIN_SHOOT_COOLDOWN) * ratio;
+      getSwarmInterval(MIN_SHOOT_COOLDOWN, MAX_SHOOT_COOLDOWN, count);
 }
 
-void updateSwarm(Swarm *swarm, float deltaTime, unsigned screenWidth) {
-  if (!swarm)
+// ==========================================
+//               GRID (SWARM_GRID)
+// ==========================================
+
+static void initGrid(Swarm *s) {
+  s->direction = 1; // Start moving Right
+
+  // Initialize Difficulty Timers (full swarm: slowest speeds)
+  s->animationFrame = false;
+  fillSwarmAlive(&s->alive);
+  updateSwarmSpeed(s);
+
+  // Ensure Boss is disabled for the grid
+  s->boss.active = false;
+
+  // Grid Generation Loop: positions follow from the origin and the slot
+  s->originX = FIXED(ENEMY_START_X);
+  s->originY = FIXED(ENEMY_START_Y);
+  int index = 0;
+  for (int row = 0; row < ENEMY_ROWS; row++) {
+    for (int col = 0; col < ENEMY_COLS; col++) {
+      s->enemies[index].width = ENEMY_WIDTH;
+      s->enemies[index].height = ENEMY_HEIGHT;
+      s->enemies[index].active = true;
+      s->enemies[index].killScore = ENEMY_KILL_SCORE;
+      index++;
+    }
+  }
+  s->enemyHash = hashSwarmEnemies(s);
+}
+
+static void updateGrid(Swarm *swarm, Fixed deltaTime, TimerTime now,
+                       unsigned screenWidth) {
+  (void)deltaTime; // Stepped, not continuous
+
+  // If it's time to move (the interval shrinks as enemies die):
+  if (now < swarm->lastMoveAt + swarm->moveInterval)
     return;
 
-  // --- SWARM BEHAVIOR (LEVEL 1) ---
-  if (swarm->level == 1) {
-    updateSwarmSpeed(swarm);
-
-    // Accumulate time for the next "Step"
-    swarm->moveTimer += deltaTime;
-
-    // If it's time to move:
-    if (swarm->moveTimer >= swarm->moveInterval) {
-      swarm->moveTimer = 0.0f;
-      changeFrame(swarm); // Toggle animation (Arms Up/Down)
-
-      // 1. Check current edges of the swarm (using the first and last column
-      // logic is naive but efficient) Note: A more robust check finds the
-      // min/max X of *active* enemies. For this implementation, we assume the
-      // outer bounds are roughly static relative to grid index. (Improving this
-      // would require iterating all active enemies to find the true bounding
-      // box).
-
-      float leftEdgeX = swarm->enemies[0].x;
-      float rightEdgeX = swarm->enemies[ENEMY_COLS - 1].x + ENEMY_WIDTH;
-      // Note: This edge logic works best if the swarm stays rectangular.
-      // If the player kills the edge columns first, the swarm might "overshoot"
-      // visually.
-
-      bool hitEdge = false;
-
-      // Check Right Wall
-      if (swarm->direction == 1 && rightEdgeX >= screenWidth) {
-        hitEdge = true;
-      }
-      // Check Left Wall
-      else if (swarm->direction == -1 && leftEdgeX <= 0) {
-        hitEdge = true;
-      }
-
-      if (hitEdge) {
-        // HIT WALL: Reverse direction and Drop Down
-        swarm->direction *= -1;
-        for (int i = 0; i < TOTAL_ENEMIES; i++) {
-          swarm->enemies[i].y += ENEMY_DROP_AMOUNT;
-        }
-      } else {
-        // NO WALL: Just move sideways
-        float step = ENEMY_STEP_X * swarm->direction;
-        for (int i = 0; i < TOTAL_ENEMIES; i++) {
-          swarm->enemies[i].x += step;
-        }
-      }
-    }
+  swarm->lastMoveAt = now;
+  changeFrame(swarm); // Toggle animation (Arms Up/Down)
+
+  // 1. Check the true edges of the swarm: the outermost columns that
+  // still hold a living enemy (empty outer columns no longer count)
+  Fixed leftEdgeX = swarm->originX;
+  Fixed rightEdgeX =
+      swarm->originX + FIXED((ENEMY_COLS - 1) * ENEMY_PITCH_X + ENEMY_WIDTH);
+  getSwarmEdges(&swarm->alive, swarm->originX, &leftEdgeX, &rightEdgeX);
+
+  bool hitEdge = false;
+
+  // Check Right Wall
+  if (swarm->direction == 1 && rightEdgeX >= FIXED(screenWidth)) {
+    hitEdge = true;
   }
-  // --- BOSS BEHAVIOR (LEVEL 2) ---
-  else if (swarm->level == 2 && swarm->boss.active) {
-    float speed = 150.0f;
-    // Continuous movement (float physics), not stepped
-    swarm->boss.x += swarm->boss.direction * speed * deltaTime;
-
-    // Simple Bounce Logic
-    if (swarm->boss.x <= 0) {
-      swarm->boss.x = 0;
-      swarm->boss.direction = 1;
-    } else if (swarm->boss.x + swarm->boss.width >= screenWidth) {
-      swarm->boss.x = screenWidth - swarm->boss.width;
-      swarm->boss.direction = -1;
-    }
+  // Check Left Wall
+  else if (swarm->direction == -1 && leftEdgeX <= 0) {
+    hitEdge = true;
+  }
+
+  if (hitEdge) {
+    // HIT WALL: Reverse direction and Drop Down
+    swarm->direction *= -1;
+    swarm->originY += ENEMY_DROP_AMOUNT;
+  } else {
+    // NO WALL: Just move sideways (the whole grid follows its origin)
+    swarm->originX += ENEMY_STEP_X * swarm->direction;
   }
 }
 
-bool enemyAttemptShoot(Swarm *swarm, Projectiles *projectiles,
-                       float deltaTime) {
-  if (!swarm || !projectiles)
+/**
+ * @brief Goal: Pick a random column, find the bottom-most enemy, and shoot.
+ * The masks give the first non-empty column (wrapping around) and its
+ * bottom-most enemy directly.
+ */
+static bool shootGrid(Swarm *swarm, Projectiles *projectiles) {
+  int startCol = (int)rngRange(&swarm->rng, ENEMY_COLS); // Random column
+  int index = pickSwarmShooter(&swarm->alive, startCol);
+  if (index < 0)
     return false;
 
-  // 1. Update Cooldown Timer
-  if (swarm->shootTimer > 0) {
-    swarm->shootTimer -= deltaTime;
-    return false;
-  }
+  Enemy *shooter = &swarm->enemies[index];
+  Fixed bulletX = getEnemyX(swarm, index) + FIXED(shooter->width) / 2 -
+                  FIXED(PROJECTILE_WIDTH) / 2;
+  Fixed bulletY = getEnemyY(swarm, index) + FIXED(shooter->height);
 
-  // 2. Reset Timer (Reload)
-  swarm->shootTimer = swarm->shootCooldown;
+  spawnProjectile(projectiles, bulletX, bulletY, MOVE_DOWN);
+  return true;
+}
 
-  // --- BOSS SHOOTING PATTERN ---
-  if (swarm->level == 2 && swarm->boss.active) {
-    float bulletX =
-        swarm->boss.x + (swarm->boss.width / 2.0f) - (PROJECTILE_WIDTH / 2.0f);
-    float bulletY = swarm->boss.y + swarm->boss.height;
+static bool isGridDestroyed(const Swarm *swarm) {
+  return swarm->aliveCount == 0;
+}
 
-    // Boss fires a "Spread Shot" (3 bullets)
-    spawnProjectile(projectiles, bulletX, bulletY, MOVE_DOWN);
-    spawnProjectile(projectiles, bulletX, bulletY, MOVE_DOWN_LEFT);
-    spawnProjectile(projectiles, bulletX, bulletY, MOVE_DOWN_RIGHT);
+// ==========================================
+//               BOSS (SWARM_BOSS)
+// ==========================================
+
+static void initBoss(Swarm *s) {
+  // The standard swarm enemies stay disabled (zeroed)
+
+  // Initialize Boss Entity
+  s->boss.active = true;
+  s->boss.width = FIXED(BOSS_WIDTH);
+  s->boss.height = FIXED(BOSS_HEIGHT);
+  s->boss.x = FIXED(400 - 32); // Start Center
+  s->boss.y = FIXED(80);       // Start Top
+  s->boss.health = 20;         // HP
+  s->boss.maxHealth = 20;
+  s->boss.direction = 1; // Moving Right
+  s->shootCooldown = secondsToTimer(0.5f); // Boss shoots faster
+}
 
-    return true;
+static void updateBoss(Swarm *swarm, Fixed deltaTime, TimerTime now,
+                       unsigned screenWidth) {
+  (void)now; // Continuous movement, not stepped
+  if (!swarm->boss.active)
+    return;
+
+  swarm->boss.x += swarm->boss.direction * fixedMul(BOSS_SPEED, deltaTime);
+
+  // Simple Bounce Logic
+  if (swarm->boss.x <= 0) {
+    swarm->boss.x = 0;
+    swarm->boss.direction = 1;
+  } else if (swarm->boss.x + swarm->boss.width >= FIXED(screenWidth)) {
+    swarm->boss.x = FIXED(screenWidth) - swarm->boss.width;
+    swarm->boss.direction = -1;
   }
+}
+
+static bool shootBoss(Swarm *swarm, Projectiles *projectiles) {
+  if (!swarm->boss.active)
+    return false;
 
-  // --- SWARM SHOOTING STRATEGY ---
-  // Goal: Pick a random column, find the bottom-most enemy, and shoot.
+  Fixed bulletX =
+      swarm->boss.x + swarm->boss.width / 2 - FIXED(PROJECTILE_WIDTH) / 2;
+  Fixed bulletY = swarm->boss.y + swarm->boss.height;
 
-  int attempts = ENEMY_COLS;
-  int startCol = rand() % ENEMY_COLS; // Random starting column
+  // Boss fires a "Spread Shot" (3 bullets)
+  static const DirectionProjectile spread[] = {MOVE_DOWN, MOVE_DOWN_LEFT,
+                                               MOVE_DOWN_RIGHT};
+  spawnProjectiles(projectiles, bulletX, bulletY, spread, 3);
+  return true;
+}
 
-  for (int i = 0; i < attempts; i++) {
-    // Wrap around columns if the chosen one is empty
-    int col = (startCol + i) % ENEMY_COLS;
+static bool isBossDestroyed(const Swarm *swarm) { return !swarm->boss.active; }
 
-    // Search from Bottom Row -> Up
-    for (int row = ENEMY_ROWS - 1; row >= 0; row--) {
-      int index = row * ENEMY_COLS + col;
+// ==========================================
+//               LEVEL TABLES
+// ==========================================
 
-      if (swarm->enemies[index].active) {
-        Enemy *shooter = &swarm->enemies[index];
+static const SwarmBehavior swarmBehaviors[SWARM_KIND_COUNT] = {
+    [SWARM_GRID] = {initGrid, updateGrid, shootGrid, isGridDestroyed},
+    [SWARM_BOSS] = {initBoss, updateBoss, shootBoss, isBossDestroyed},
+};
 
-        float bulletX =
-            shooter->x + (shooter->width / 2.0f) - (PROJECTILE_WIDTH / 2.0f);
-        float bulletY = shooter->y + shooter->height;
+/** @brief What each level is made of, level 1 first. */
+static const SwarmKind levelKinds[] = {
+    SWARM_GRID, // 1: the classic invasion
+    SWARM_BOSS, // 2: the Mother Ship
+};
 
-        spawnProjectile(projectiles, bulletX, bulletY, MOVE_DOWN);
-        return true; // Shot fired, exit function
-      }
-    }
-  }
-  return false;
+_Static_assert(sizeof(levelKinds) / sizeof(levelKinds[0]) == LEVEL_COUNT,
+               "LEVEL_COUNT must match the level table");
+
+SwarmKind getLevelKind(int level) {
+  if (level < 1)
+    level = 1;
+  if (level > LEVEL_COUNT)
+    level = LEVEL_COUNT;
+  return levelKinds[level - 1];
+}
+
+const SwarmBehavior *getSwarmBehavior(SwarmKind kind) {
+  return &swarmBehaviors[kind];
+}
+
+// ==========================================
+//               DISPATCH
+// ==========================================
+
+void updateSwarm(Swarm *swarm, Fixed deltaTime, TimerTime now,
+                 unsigned screenWidth) {
+  if (!swarm)
+    return;
+
+  swarmBehaviors[swarm->kind].update(swarm, deltaTime, now, screenWidth);
+}
+
+bool enemyAttemptShoot(Swarm *swarm, Projectiles *projectiles, TimerTime now) {
+  if (!swarm || !projectiles)
+    return false;
+
+  // 1. Check Cooldown
+  if (now < swarm->shootAt)
+    return false;
+
+  // 2. Schedule the next shot (Reload)
+  swarm->shootAt = now + swarm->shootCooldown;
+
+  // 3. Fire the way this level does
+  return swarmBehaviors[swarm->kind].shoot(swarm, projectiles);
 }
 
 bool isSwarmDestroyed(const Swarm *swarm) {
   if (!swarm)
     return true;
 
-  if (swarm->level == 2) {
-    return !swarm->boss.active;
-  }
-
-  return (swarm->aliveCount == 0);
+  return swarmBehaviors[swarm->kind].isDestroyed(swarm);
 }
 
 void changeFrame(Swarm *swarm) {
@@ -0,0 +1,452 @@
+#define _GNU_SOURCE // syscall()
+#include "../../includes/sim_float.h"
+#include "../../includes/env_server.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+// ==========================================
+//               LAYOUT
+// ==========================================
+
+/** @brief Rounds `size` up to a whole number of cache lines. */
+#define ENV_ALIGN(size) (((size) + 63) / 64 * 64)
+
+/**
+ * @brief Start of the mapping. Written once by the owner, then read-only
+ * (except `shutdown`).
+ */
+typedef struct {
+  uint32_t magic;            /**< ENV_SERVER_MAGIC. */
+  uint32_t version;          /**< ENV_SERVER_VERSION. */
+  uint32_t workers;          /**< M. */
+  uint32_t worlds;           /**< K. */
+  uint64_t channelSize;      /**< Bytes per worker channel. */
+  uint64_t mappingSize;      /**< Total bytes of the mapping. */
+  _Atomic uint32_t shutdown; /**< Set to stop the workers. */
+} EnvShmHeader;
+
+/** @brief Start-up of a worker, as seen by the owner (EnvChannel.state). */
+typedef enum {
+  ENV_WORKER_STARTING = 0, /**< Creating its games. */
+  ENV_WORKER_READY = 1,    /**< Serving requests. */
+  ENV_WORKER_FAILED = 2    /**< Could not create its games: exits. */
+} EnvWorkerState;
+
+/**
+ * @brief Ring counters of one worker. Each counter has a single writer and
+ * its own cache line. The request and response slots follow the struct.
+ */
+typedef struct {
+  _Alignas(64) _Atomic uint32_t state;         /**< Worker: EnvWorkerState. */
+  _Alignas(64) _Atomic uint32_t requestHead;   /**< Client: submitted. */
+  _Alignas(64) _Atomic uint32_t workerWaiting; /**< Worker: in futex. */
+  _Alignas(64) _Atomic uint32_t responseHead;  /**< Worker: completed. */
+  _Alignas(64) _Atomic uint32_t clientWaiting; /**< Client: in futex. */
+  _Alignas(64) _Atomic uint32_t responseTail;  /**< Client: released. */
+} EnvChannel;
+
+struct EnvServer {
+  unsigned char *base; /**< The shared mapping. */
+  size_t size;
+  EnvShmHeader *header;
+  bool owner;  /**< Created the server (owns the workers and the name). */
+  pid_t *pids; /**< Worker processes (owner only). */
+  char *name;  /**< shm name (owner only, for shm_unlink). */
+};
+
+static size_t requestSlotSize(uint32_t worlds) {
+  return ENV_ALIGN(worlds * sizeof(EnvCommand));
+}
+
+static size_t responseSlotSize(uint32_t worlds) {
+  return ENV_ALIGN(worlds * sizeof(EnvResult));
+}
+
+static EnvChannel *getChannel(const EnvServer *s, int worker) {
+  return (EnvChannel *)(s->base + ENV_ALIGN(sizeof(EnvShmHeader)) +
+                        worker * s->header->channelSize);
+}
+
+static EnvCommand *getRequestSlot(const EnvServer *s, int worker,
+                                  uint32_t seq) {
+  unsigned char *slots = (unsigned char *)(getChannel(s, worker) + 1);
+  return (EnvCommand *)(slots + (seq % ENV_RING_SLOTS) *
+                                    requestSlotSize(s->header->worlds));
+}
+
+static EnvResult *getResponseSlot(const EnvServer *s, int worker,
+                                  uint32_t seq) {
+  unsigned char *slots = (unsigned char *)(getChannel(s, worker) + 1) +
+                         ENV_RING_SLOTS * requestSlotSize(s->header->worlds);
+  return (EnvResult *)(slots + (seq % ENV_RING_SLOTS) *
+                                   responseSlotSize(s->header->worlds));
+}
+
+// ==========================================
+//               WAKEUPS
+// ==========================================
+
+static void futexWait(_Atomic uint32_t *word, uint32_t expected) {
+#ifdef __linux__
+  // The timeout lets the sleeper notice a shutdown request
+  struct timespec timeout = {0, 100 * 1000 * 1000};
+  syscall(SYS_futex, (uint32_t *)word, FUTEX_WAIT, expected, &timeout, NULL,
+          0);
+#else
+  (void)word;
+  (void)expected;
+  sched_yield();
+#endif
+}
+
+static void futexWake(_Atomic uint32_t *word) {
+#ifdef __linux__
+  syscall(SYS_futex, (uint32_t *)word, FUTEX_WAKE, 1, NULL, NULL, 0);
+#else
+  (void)word;
+#endif
+}
+
+/**
+ * @brief Waits until `*word` differs from `seen`.
+ * Spins first; sleeps on the futex only after announcing it in `*waiting`.
+ * @return false if the server is shutting down.
+ */
+static bool waitChange(EnvShmHeader *header, _Atomic uint32_t *word,
+                       uint32_t seen, _Atomic uint32_t *waiting) {
+  for (int i = 0; i < ENV_SERVER_SPIN; i++) {
+    if (atomic_load_explicit(word, memory_order_acquire) != seen)
+      return true;
+    if ((i & 255) == 255)
+      sched_yield(); // Let the other side run on a busy machine
+  }
+
+  atomic_store(waiting, 1);
+  while (atomic_load(word) == seen) {
+    if (atomic_load_explicit(&header->shutdown, memory_order_relaxed)) {
+      atomic_store(waiting, 0);
+      return false;
+    }
+    futexWait(word, seen);
+  }
+  atomic_store(waiting, 0);
+  return true;
+}
+
+/** @brief Publishes `value` and wakes the other side only if it sleeps. */
+static void publish(_Atomic uint32_t *word, uint32_t value,
+                    _Atomic uint32_t *waiting) {
+  atomic_store(word, value);
+  if (atomic_load(waiting))
+    futexWake(word);
+}
+
+// ==========================================
+//               WORKER PROCESS
+// ==========================================
+
+/** @brief Runs one request: K commands in, K results out. */
+static void serveRequest(SiEnv **envs, uint32_t worlds,
+                         const EnvCommand *commands, EnvResult *results) {
+  for (uint32_t i = 0; i < worlds; i++) {
+    const EnvCommand *c = &commands[i];
+    uint32_t events = 0;
+
+    if (c->type == ENV_COMMAND_RESET) {
+      siReset(envs[i], c->seed);
+    } else {
+      uint32_t frames = c->frames ? c->frames : 1;
+      for (uint32_t f = 0; f < frames; f++) {
+        events |= siStep(envs[i], c->action);
+        // Stop skipping frames once the game is over
+        if (events & (SI_EVENT_PLAYER_DIED | SI_EVENT_GAME_WON))
+          break;
+      }
+    }
+
+    siObserve(envs[i], &results[i].observation);
+    results[i].events = events;
+    results[i].reserved = 0;
+  }
+}
+
+/**
+ * @brief Body of worker process `worker`: creates its games, reports
+ * whether it could (EnvChannel.state), then serves until shutdown.
+ * @return false if the games could not be created.
+ */
+static bool runWorker(EnvServer *s, int worker, int32_t level,
+                      uint64_t seed) {
+  uint32_t worlds = s->header->worlds;
+  EnvChannel *ch = getChannel(s, worker);
+  SiEnv **envs = (SiEnv **)calloc(worlds, sizeof(SiEnv *));
+
+  bool ready = envs != NULL;
+  for (uint32_t i = 0; i < worlds && ready; i++) {
+    envs[i] = siCreate(SI_SCREEN_WIDTH, SI_SCREEN_HEIGHT, level,
+                       seed + (uint64_t)worker * worlds + i);
+    ready = envs[i] != NULL;
+  }
+  atomic_store(&ch->state, ready ? ENV_WORKER_READY : ENV_WORKER_FAILED);
+  futexWake(&ch->state);
+
+  uint32_t next = 0; // Next request to serve
+  while (ready &&
+         waitChange(s->header, &ch->requestHead, next, &ch->workerWaiting)) {
+    // Serve everything that is queued, reporting each request when done
+    uint32_t head =
+        atomic_load_explicit(&ch->requestHead, memory_order_acquire);
+    for (; next != head; next++) {
+      serveRequest(envs, worlds, getRequestSlot(s, worker, next),
+                   getResponseSlot(s, worker, next));
+      publish(&ch->responseHead, next + 1, &ch->clientWaiting);
+    }
+  }
+
+  for (uint32_t i = 0; envs && i < worlds; i++)
+    siDestroy(envs[i]);
+  free(envs);
+  return ready;
+}
+
+/**
+ * @brief Waits until worker `worker` reports its start-up. A worker that
+ * exits (or is killed) before reporting counts as failed.
+ * @return true if it is ready to serve.
+ */
+static bool waitWorkerReady(EnvServer *s, int worker) {
+  EnvChannel *ch = getChannel(s, worker);
+  for (;;) {
+    uint32_t state = atomic_load(&ch->state);
+    if (state != ENV_WORKER_STARTING)
+      return state == ENV_WORKER_READY;
+
+    if (waitpid(s->pids[worker], NULL, WNOHANG) == s->pids[worker]) {
+      s->pids[worker] = 0; // Reaped: nothing left to wait for
+      return atomic_load(&ch->state) == ENV_WORKER_READY;
+    }
+    futexWait(&ch->state, ENV_WORKER_STARTING);
+  }
+}
+
+// ==========================================
+//           PUBLIC FUNCTIONS
+// ==========================================
+
+EnvServer *createEnvServer(const char *name, int workers, int worldsPerWorker,
+                           int32_t level, uint64_t seed) {
+  if (!name || workers <= 0 || worldsPerWorker <= 0)
+    return NULL;
+
+  EnvServer *s = (EnvServer *)calloc(1, sizeof(EnvServer));
+  if (!s)
+    return NULL;
+  s->owner = true;
+  s->name = strdup(name);
+  s->pids = (pid_t *)calloc(workers, sizeof(pid_t));
+
+  size_t channelSize = sizeof(EnvChannel) +
+                       ENV_RING_SLOTS * (requestSlotSize(worldsPerWorker) +
+                                         responseSlotSize(worldsPerWorker));
+  s->size = ENV_ALIGN(sizeof(EnvShmHeader)) + workers * channelSize;
+
+  // O_EXCL: never take over the name of another server (EEXIST)
+  int fd = s->name && s->pids
+               ? shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600)
+               : -1;
+  if (fd < 0 || ftruncate(fd, (off_t)s->size) != 0) {
+    int error = errno;
+    if (fd >= 0) {
+      close(fd);
+      shm_unlink(name);
+    }
+    free(s->name);
+    free(s->pids);
+    free(s);
+    errno = error;
+    return NULL;
+  }
+
+  s->base = mmap(NULL, s->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (s->base == MAP_FAILED) {
+    shm_unlink(name);
+    free(s->name);
+    free(s->pids);
+    free(s);
+    return NULL;
+  }
+
+  // ftruncate() zero-filled the mapping: every ring starts empty
+  s->header = (EnvShmHeader *)s->base;
+  s->header->magic = ENV_SERVER_MAGIC;
+  s->header->version = ENV_SERVER_VERSION;
+  s->header->workers = workers;
+  s->header->worlds = worldsPerWorker;
+  s->header->channelSize = channelSize;
+  s->header->mappingSize = s->size;
+
+  for (int w = 0; w < workers; w++) {
+    pid_t pid = fork();
+    if (pid == 0)
+      _exit(runWorker(s, w, level, seed) ? EXIT_SUCCESS : EXIT_FAILURE);
+    if (pid < 0) {
+      destroyEnvServer(s);
+      return NULL;
+    }
+    s->pids[w] = pid;
+  }
+
+  // A worker without its games would leave its channel unanswered
+  for (int w = 0; w < workers; w++) {
+    if (!waitWorkerReady(s, w)) {
+      destroyEnvServer(s);
+      return NULL;
+    }
+  }
+  return s;
+}
+
+bool removeEnvServer(const char *name) {
+  return name && shm_unlink(name) == 0;
+}
+
+EnvServer *attachEnvServer(const char *name) {
+  if (!name)
+    return NULL;
+
+  int fd = shm_open(name, O_RDWR, 0600);
+  if (fd < 0)
+    return NULL;
+
+  // Read the header first to learn the full size
+  EnvShmHeader header;
+  if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+      header.magic != ENV_SERVER_MAGIC ||
+      header.version != ENV_SERVER_VERSION) {
+    close(fd);
+    return NULL;
+  }
+
+  EnvServer *s = (EnvServer *)calloc(1, sizeof(EnvServer));
+  if (!s) {
+    close(fd);
+    return NULL;
+  }
+  s->size = header.mappingSize;
+  s->base = mmap(NULL, s->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (s->base == MAP_FAILED) {
+    free(s);
+    return NULL;
+  }
+  s->header = (EnvShmHeader *)s->base;
+  return s;
+}
+
+void shutdownEnvServer(EnvServer *s) {
+  if (!s)
+    return;
+
+  atomic_store(&s->header->shutdown, 1);
+  for (uint32_t w = 0; w < s->header->workers; w++) {
+    EnvChannel *ch = getChannel(s, w);
+    futexWake(&ch->requestHead);
+    futexWake(&ch->responseHead);
+  }
+}
+
+void waitEnvServer(EnvServer *s) {
+  if (!s || !s->owner)
+    return;
+
+  for (uint32_t w = 0; w < s->header->workers; w++) {
+    if (s->pids[w] > 0) {
+      waitpid(s->pids[w], NULL, 0);
+      s->pids[w] = 0;
+    }
+  }
+}
+
+void destroyEnvServer(EnvServer *s) {
+  if (!s)
+    return;
+
+  if (s->owner) {
+    shutdownEnvServer(s);
+    waitEnvServer(s);
+    shm_unlink(s->name);
+    free(s->name);
+    free(s->pids);
+  }
+  munmap(s->base, s->size);
+  free(s);
+}
+
+int getEnvServerWorkers(const EnvServer *s) {
+  return s ? (int)s->header->workers : 0;
+}
+
+int getEnvServerWorlds(const EnvServer *s) {
+  return s ? (int)s->header->worlds : 0;
+}
+
+EnvCommand *beginEnvRequest(EnvServer *s, int worker) {
+  if (!s || worker < 0 || worker >= (int)s->header->workers)
+    return NULL;
+
+  EnvChannel *ch = getChannel(s, worker);
+  uint32_t head = atomic_load_explicit(&ch->requestHead, memory_order_relaxed);
+  uint32_t tail = atomic_load_explicit(&ch->responseTail, memory_order_relaxed);
+
+  // A slot is free once the response of its previous use was released
+  if (head - tail >= ENV_RING_SLOTS)
+    return NULL;
+  return getRequestSlot(s, worker, head);
+}
+
+void submitEnvRequest(EnvServer *s, int worker) {
+  if (!s || worker < 0 || worker >= (int)s->header->workers)
+    return;
+
+  EnvChannel *ch = getChannel(s, worker);
+  uint32_t head = atomic_load_explicit(&ch->requestHead, memory_order_relaxed);
+  publish(&ch->requestHead, head + 1, &ch->workerWaiting);
+}
+
+const EnvResult *waitEnvResponse(EnvServer *s, int worker) {
+  if (!s || worker < 0 || worker >= (int)s->header->workers)
+    return NULL;
+
+  EnvChannel *ch = getChannel(s, worker);
+  uint32_t tail = atomic_load_explicit(&ch->responseTail, memory_order_relaxed);
+  if (tail == atomic_load_explicit(&ch->requestHead, memory_order_relaxed))
+    return NULL; // Nothing in flight
+
+  // Already completed? Then no wait at all.
+  if (atomic_load_explicit(&ch->responseHead, memory_order_acquire) == tail &&
+      !waitChange(s->header, &ch->responseHead, tail, &ch->clientWaiting))
+    return NULL;
+  return getResponseSlot(s, worker, tail);
+}
+
+void releaseEnvResponse(EnvServer *s, int worker) {
+  if (!s || worker < 0 || worker >= (int)s->header->workers)
+    return;
+
+  EnvChannel *ch = getChannel(s, worker);
+  uint32_t tail = atomic_load_explicit(&ch->responseTail, memory_order_relaxed);
+  atomic_store_explicit(&ch->responseTail, tail + 1, memory_order_release);
+}
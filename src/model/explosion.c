@@ -1,3 +1,4 @@
+#include "../../includes/sim_float.h"
 #include "../../includes/explosion.h"
 #include <stdlib.h>
 
@@ -8,12 +9,19 @@ ExplosionManager *createExplosionManager(void) {
   if (!em)
     return NULL;
 
+  initExplosionManager(em);
+  return em;
+}
+
+void initExplosionManager(ExplosionManager *em) {
+  if (!em)
+    return;
+
   // Explicitly ensure all slots are inactive (redundant with calloc but good
   // for clarity)
   for (int i = 0; i < MAX_EXPLOSIONS; i++) {
     em->explosions[i].active = false;
   }
-  return em;
 }
 
 void destroyExplosionManager(ExplosionManager *em) {
@@ -21,9 +29,14 @@ void destroyExplosionManager(ExplosionManager *em) {
     free(em);
 }
 
-void spawnExplosion(ExplosionManager *em, float x, float y) {
+/** @brief How long each frame of an explosion is shown. */
+static inline TimerTime getFrameDuration(void) {
+  return secondsToTimer(EXPLOSION_DURATION) / EXPLOSION_FRAMES;
+}
+
+int spawnExplosion(ExplosionManager *em, Fixed x, Fixed y, TimerTime now) {
   if (!em)
-    return;
+    return -1;
 
   // Object Pool Logic: Find the first available (inactive) slot
   for (int i = 0; i < MAX_EXPLOSIONS; i++) {
@@ -32,46 +45,38 @@ void spawnExplosion(ExplosionManager *em, float x, float y) {
       em->explosions[i].x = x;
       em->explosions[i].y = y;
 
-      // Reset timer to full duration
-      em->explosions[i].timer = EXPLOSION_DURATION;
-
       // Start at the first animation frame
       em->explosions[i].currentFrame = 0;
+      em->explosions[i].nextFrameAt = now + getFrameDuration();
 
       // Activate the slot
       em->explosions[i].active = true;
-      return; // Exit as soon as we spawn one
+      return i; // Exit as soon as we spawn one
     }
   }
   // If loop finishes without returning, the pool was full (explosion ignored).
+  return -1;
+}
+
+bool advanceExplosion(Explosion *explosion, TimerTime now) {
+  // A long step may skip frames: catch up one frame at a time
+  while (now >= explosion->nextFrameAt) {
+    if (++explosion->currentFrame >= EXPLOSION_FRAMES) {
+      explosion->active = false; // Finished playing
+      return false;
+    }
+    explosion->nextFrameAt += getFrameDuration();
+  }
+  return true;
 }
 
-void updateExplosions(ExplosionManager *em, float deltaTime) {
+void updateExplosions(ExplosionManager *em, TimerTime now) {
   if (!em)
     return;
 
   for (int i = 0; i < MAX_EXPLOSIONS; i++) {
-    if (em->explosions[i].active) {
-      // Decrease timer
-      em->explosions[i].timer -= deltaTime;
-
-      // Check if explosion has finished playing
-      if (em->explosions[i].timer <= 0) {
-        em->explosions[i].active = false;
-      } else {
-        // --- Animation Frame Calculation ---
-        // We calculate which frame (0, 1, or 2) to show based on remaining
-        // time. lifePercent goes from 1.0 (Start) -> 0.0 (End)
-        float lifePercent = em->explosions[i].timer / EXPLOSION_DURATION;
-
-        // Map the percentage to 3 discrete frames
-        if (lifePercent > 0.66f)
-          em->explosions[i].currentFrame = 0; // Start (Big/Bright)
-        else if (lifePercent > 0.33f)
-          em->explosions[i].currentFrame = 1; // Middle
-        else
-          em->explosions[i].currentFrame = 2; // End (Fading/Small)
-      }
-    }
+    Explosion *e = &em->explosions[i];
+    if (e->active && now >= e->nextFrameAt)
+      advanceExplosion(e, now);
   }
-}
\ No newline at end of file
+}
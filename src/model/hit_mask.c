@@ -0,0 +1,92 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/hit_mask.h"
+
+const HitMask *getHitMask(HitMaskId id) { return &hitMaskData[id]; }
+
+bool isHitMaskPixelSet(const HitMask *mask, int x, int y) {
+  return (mask->columns[x] >> y) & 1u;
+}
+
+// ==========================================
+//               TESTS
+// ==========================================
+
+static inline int clampInt(int v, int lo, int hi) {
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+/** @brief Bits [lo, hi) of a column word (0 if the range is empty). */
+static inline HitMaskColumn getRowBits(int lo, int hi) {
+  if (hi <= lo)
+    return 0;
+  HitMaskColumn bits = hi - lo >= HIT_MASK_MAX_HEIGHT
+                           ? ~(HitMaskColumn)0
+                           : ((HitMaskColumn)1 << (hi - lo)) - 1;
+  return bits << lo;
+}
+
+/**
+ * @brief Rows holding an opaque pixel under a box [left, left + w): the OR
+ * of the (at most w + 1) columns it covers.
+ */
+static inline HitMaskColumn getBandRows(const HitMask *mask, Fixed left,
+                                        Fixed w) {
+  int x0 = clampInt(fixedFloor(left), 0, mask->width);
+  int x1 = clampInt(fixedCeil(left + w), 0, mask->width);
+  HitMaskColumn rows = 0;
+  for (int x = x0; x < x1; x++)
+    rows |= mask->columns[x];
+  return rows;
+}
+
+/** @brief The rows a box [top, top + h) covers, clamped to the mask. */
+static inline HitMaskColumn getCoveredRows(const HitMask *mask, Fixed top,
+                                           Fixed h) {
+  return getRowBits(clampInt(fixedFloor(top), 0, mask->height),
+                    clampInt(fixedCeil(top + h), 0, mask->height));
+}
+
+bool testHitMask(const HitMask *mask, Fixed left, Fixed top, Fixed w,
+                 Fixed h) {
+  return (getBandRows(mask, left, w) & getCoveredRows(mask, top, h)) != 0;
+}
+
+bool sweepHitMask(const HitMask *mask, Fixed x0, Fixed y0, Fixed x1,
+                  Fixed y1, Fixed w, Fixed h, Fixed *toi) {
+  Fixed dx = x1 - x0, dy = y1 - y0;
+  Fixed spanX = dx < 0 ? -dx : dx, spanY = dy < 0 ? -dy : dy;
+
+  if (dx == 0) {
+    // Vertical path: the same columns all along, and the rows are met in
+    // order, so the leading opaque row of the swept box is the contact
+    bool up = dy < 0;
+    HitMaskColumn rows = getBandRows(mask, x0, w) &
+                         getCoveredRows(mask, up ? y1 : y0, spanY + h);
+    if (!rows)
+      return false;
+    int row = up ? 63 - __builtin_clzll(rows) : __builtin_ctzll(rows);
+
+    // Contact when the leading edge enters the row (at once if the start
+    // box already covers it)
+    Fixed t = 0;
+    if (up && row < fixedFloor(y0))
+      t = (Fixed)fixedDiv(y0 - FIXED(row + 1), y0 - y1);
+    else if (!up && row >= fixedCeil(y0 + h))
+      t = (Fixed)fixedDiv(FIXED(row) - h - y0, dy); // As sweepBox()
+    *toi = t;
+    return true;
+  }
+
+  // Other paths: sub-steps of at most one pixel (as sweepBunkers())
+  int steps = fixedCeil(spanX > spanY ? spanX : spanY);
+  for (int k = 0; k <= steps; k++) {
+    Fixed t = k == steps ? FIXED_ONE : FIXED(k) / steps;
+    Fixed left = k == steps ? x1 : x0 + fixedMul(dx, t);
+    Fixed top = k == steps ? y1 : y0 + fixedMul(dy, t);
+    if (testHitMask(mask, left, top, w, h)) {
+      *toi = t;
+      return true;
+    }
+  }
+  return false;
+}
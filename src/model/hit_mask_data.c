@@ -0,0 +1,100 @@
+// Generated by tools/gen_sprite_masks.py from assets/*.png.
+// Do not edit by hand.
+
+#include "../../includes/enemy.h"
+#include "../../includes/hit_mask.h"
+
+_Static_assert(ENEMY_WIDTH == 40 && ENEMY_HEIGHT == 30,
+               "rerun tools/gen_sprite_masks.py");
+_Static_assert(BOSS_WIDTH == 64 && BOSS_HEIGHT == 64,
+               "rerun tools/gen_sprite_masks.py");
+
+const HitMask hitMaskData[HIT_MASK_COUNT] = {
+    [HIT_MASK_ALIEN_1] =
+        {40,
+         30,
+         {
+             0x0000000000000000ull, 0x0000000000000000ull,
+             0x0000000000070000ull, 0x00000000000f8000ull,
+             0x00000000001fc000ull, 0x00000000003fe000ull,
+             0x00000000007ff000ull, 0x00000000007ff000ull,
+             0x0000000000fff800ull, 0x0000000000fff800ull,
+             0x0000000000fff800ull, 0x0000000001fffc00ull,
+             0x0000000001fffc00ull, 0x0000000001fffe00ull,
+             0x0000000003ffff00ull, 0x0000000007ffffc0ull,
+             0x0000000007ffffc0ull, 0x0000000007ffffc0ull,
+             0x0000000007ffffe0ull, 0x0000000007ffffe0ull,
+             0x0000000007ffffe0ull, 0x0000000007ffffe0ull,
+             0x0000000007ffffe0ull, 0x0000000007ffffc0ull,
+             0x0000000007ffffc0ull, 0x0000000007ffff80ull,
+             0x0000000001fffe00ull, 0x0000000001fffc00ull,
+             0x0000000001fffc00ull, 0x0000000000fff800ull,
+             0x0000000000fff800ull, 0x0000000000fff800ull,
+             0x0000000000fff000ull, 0x00000000007ff000ull,
+             0x00000000003fe000ull, 0x00000000003fe000ull,
+             0x00000000001fc000ull, 0x0000000000078000ull,
+             0x0000000000000000ull, 0x0000000000000000ull,
+         }},
+    [HIT_MASK_ALIEN_2] =
+        {40,
+         30,
+         {
+             0x0000000000000000ull, 0x0000000000000000ull,
+             0x0000000000038000ull, 0x000000000007c000ull,
+             0x00000000000fe000ull, 0x00000000001ff000ull,
+             0x00000000001ff000ull, 0x00000000003ff800ull,
+             0x00000000003ff800ull, 0x00000000007ffc00ull,
+             0x00000000007ffc00ull, 0x00000000007ffe00ull,
+             0x00000000007ffe00ull, 0x0000000000ffff00ull,
+             0x0000000001ffffc0ull, 0x0000000003ffffc0ull,
+             0x0000000003ffffe0ull, 0x0000000003ffffe0ull,
+             0x0000000003fffff0ull, 0x0000000003fffff0ull,
+             0x0000000003fffff0ull, 0x0000000003fffff0ull,
+             0x0000000003ffffe0ull, 0x0000000003ffffe0ull,
+             0x0000000003ffffc0ull, 0x0000000001ffff80ull,
+             0x0000000000ffff00ull, 0x00000000007ffe00ull,
+             0x00000000007ffe00ull, 0x00000000007ffe00ull,
+             0x00000000007ffc00ull, 0x00000000003ff800ull,
+             0x00000000003ff800ull, 0x00000000001ff000ull,
+             0x00000000001ff000ull, 0x00000000000ff000ull,
+             0x000000000007c000ull, 0x0000000000038000ull,
+             0x0000000000010000ull, 0x0000000000000000ull,
+         }},
+    [HIT_MASK_BOSS] =
+        {64,
+         64,
+         {
+             0x00000000000e0000ull, 0x00000000001f0000ull,
+             0x00000000003f0000ull, 0x00000000007f8000ull,
+             0x00000000007f8000ull, 0x0000000000ff8000ull,
+             0x0000000000ffc000ull, 0x0000000001ffc000ull,
+             0x0000000003ffe000ull, 0x000000000ffff000ull,
+             0x000000001ffff000ull, 0x000000000ffff000ull,
+             0x000000000ffff000ull, 0x000000000ffff037ull,
+             0x000000001ffff07full, 0x000000003ffff1ffull,
+             0x00000001fffff1feull, 0x00000001fffffffeull,
+             0x00000000fffffffcull, 0x00000004fffffffcull,
+             0x00000607fffffffcull, 0x000003fffffffff8ull,
+             0x00000ffffffffff8ull, 0x00000ffffffffff8ull,
+             0x00078fffffffff80ull, 0x0001ffffffffff80ull,
+             0x0003ffffffffffc0ull, 0x01ffffffffffffc0ull,
+             0x07ffffffffffffc0ull, 0x0fffffffffffff80ull,
+             0x0fffffffffffff80ull, 0x1ffffffffffffff8ull,
+             0x1ffffffffffffff8ull, 0x0fffffffffffff80ull,
+             0x0fffffffffffff80ull, 0x07ffffffffffffc0ull,
+             0x00ffffffffffffc0ull, 0x0003ffffffffffc0ull,
+             0x0001ffffffffff80ull, 0x00078fffffffff80ull,
+             0x00000ffffffffff8ull, 0x00000ffffffffff8ull,
+             0x000003fffffffff8ull, 0x00000607fffffffcull,
+             0x00000004fffffffcull, 0x00000000fffffffcull,
+             0x00000001fffffffeull, 0x00000001fffff1feull,
+             0x000000003ffff1ffull, 0x000000001ffff07full,
+             0x000000000ffff03full, 0x000000000ffff000ull,
+             0x000000000ffff000ull, 0x000000001ffff000ull,
+             0x000000000ffff000ull, 0x0000000001ffe000ull,
+             0x0000000001ffc000ull, 0x0000000000ffc000ull,
+             0x0000000000ff8000ull, 0x00000000007f8000ull,
+             0x00000000007f8000ull, 0x00000000003f0000ull,
+             0x00000000001f0000ull, 0x00000000000e0000ull,
+         }},
+};
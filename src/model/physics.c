@@ -1,21 +1,348 @@
+#include "../../includes/sim_float.h"
 #include "../../includes/physics.h"
+#include "../../includes/aabb_simd.h"
 #include "../../includes/bunker.h"
 #include <stdbool.h>
-#include <stdio.h>
+#include <stddef.h>
 
 /**
  * @brief Helper function for AABB (Axis-Aligned Bounding Box) overlap checks.
  * Returns true if two rectangles intersect.
  */
-bool checkOverlap(float x1, float y1, float w1, float h1, float x2, float y2,
-                  float w2, float h2) {
+bool checkOverlap(Fixed x1, Fixed y1, Fixed w1, Fixed h1, Fixed x2, Fixed y2,
+                  Fixed w2, Fixed h2) {
   // Logic: The rectangles overlap if they are NOT separated on any axis.
   return (x1 < x2 + w2 && x1 + w1 > x2 && y1 < y2 + h2 && y1 + h1 > y2);
 }
 
+/** @brief a / b rounded down, for b > 0 (C division rounds to zero). */
+static inline int floorDiv(Fixed a, Fixed b) {
+  return a / b - (a % b < 0);
+}
+
+/** @brief a / b rounded up, for b > 0. */
+static inline int ceilDiv(Fixed a, Fixed b) { return -floorDiv(-a, b); }
+
+bool getSwarmCellRange(Fixed originX, Fixed originY, Fixed x, Fixed y,
+                       Fixed w, Fixed h, int *col0, int *row0, int *col1,
+                       int *row1) {
+  // Column c holds an enemy on [originX + c * pitch, + ENEMY_WIDTH): the
+  // box reaches it if c > (x - originX - ENEMY_WIDTH) / pitch and
+  // c < (x + w - originX) / pitch. The quotients are exact, so the range
+  // is the first and last whole number strictly between those bounds.
+  Fixed pitchX = FIXED(ENEMY_PITCH_X), pitchY = FIXED(ENEMY_PITCH_Y);
+  int c0 = floorDiv(x - originX - FIXED(ENEMY_WIDTH), pitchX) + 1;
+  int r0 = floorDiv(y - originY - FIXED(ENEMY_HEIGHT), pitchY) + 1;
+  int c1 = ceilDiv(x + w - originX, pitchX) - 1;
+  int r1 = ceilDiv(y + h - originY, pitchY) - 1;
+
+  if (c0 < 0)
+    c0 = 0;
+  if (r0 < 0)
+    r0 = 0;
+  if (c1 > ENEMY_COLS - 1)
+    c1 = ENEMY_COLS - 1;
+  if (r1 > ENEMY_ROWS - 1)
+    r1 = ENEMY_ROWS - 1;
+  if (c0 > c1 || r0 > r1)
+    return false;
+
+  *col0 = c0;
+  *row0 = r0;
+  *col1 = c1;
+  *row1 = r1;
+  return true;
+}
+
+int findSwarmHit(const Swarm *swarm, Fixed x, Fixed y, Fixed w, Fixed h) {
+  int c0, r0, c1, r1;
+  if (!getSwarmCellRange(swarm->originX, swarm->originY, x, y, w, h, &c0,
+                         &r0, &c1, &r1))
+    return -1;
+
+  // Row-major order: the first hit is also the lowest index
+  for (int row = r0; row <= r1; row++) {
+    Fixed ey = swarm->originY + FIXED(row * ENEMY_PITCH_Y);
+    for (int col = c0; col <= c1; col++) {
+      int j = row * ENEMY_COLS + col;
+      const Enemy *e = &swarm->enemies[j];
+      Fixed ex = swarm->originX + FIXED(col * ENEMY_PITCH_X);
+      if (e->active && checkOverlap(x, y, w, h, ex, ey, FIXED(e->width),
+                                    FIXED(e->height)))
+        return j;
+    }
+  }
+  return -1;
+}
+
+int scanSwarmHit(const Swarm *swarm, Fixed x, Fixed y, Fixed w, Fixed h) {
+  for (int j = 0; j < TOTAL_ENEMIES; j++) {
+    const Enemy *e = &swarm->enemies[j];
+    if (e->active &&
+        checkOverlap(x, y, w, h, getEnemyX(swarm, j), getEnemyY(swarm, j),
+                     FIXED(e->width), FIXED(e->height)))
+      return j;
+  }
+  return -1;
+}
+
+/**
+ * @brief One slab of sweepBox(): narrows [enter, leave) to the times when
+ * lo < start + t * delta < hi. The times are kept on 64 bits: a slab far
+ * from a short path lies many paths away.
+ * @return false if that interval is empty.
+ */
+static inline bool sweepAxis(Fixed start, Fixed delta, Fixed lo, Fixed hi,
+                             int64_t *enter, int64_t *leave) {
+  if (delta == 0)
+    return lo < start && start < hi;
+
+  int64_t t0 = fixedDiv(lo - start, delta);
+  int64_t t1 = fixedDiv(hi - start, delta);
+  if (t0 > t1) {
+    int64_t t = t0;
+    t0 = t1;
+    t1 = t;
+  }
+  if (t0 > *enter)
+    *enter = t0;
+  if (t1 < *leave)
+    *leave = t1;
+  return *enter < *leave;
+}
+
+bool sweepBox(Fixed x0, Fixed y0, Fixed x1, Fixed y1, Fixed w, Fixed h,
+              Fixed bx, Fixed by, Fixed bw, Fixed bh, Fixed *toi) {
+  // The moving box overlaps the target while its corner is strictly inside
+  // the target grown by (w, h)
+  int64_t enter = 0, leave = FIXED_ONE;
+  if (!sweepAxis(x0, x1 - x0, bx - w, bx + bw, &enter, &leave) ||
+      !sweepAxis(y0, y1 - y0, by - h, by + bh, &enter, &leave))
+    return false;
+
+  *toi = (Fixed)enter;
+  return true;
+}
+
+int sweepSwarmHit(const SwarmAlive *alive, Fixed originX, Fixed originY,
+                  const HitMask *mask, Fixed x0, Fixed y0, Fixed x1, Fixed y1,
+                  Fixed w, Fixed h, Fixed *toi) {
+  // Candidate cells: those of the box bounding the whole path
+  Fixed sx = x0 < x1 ? x0 : x1;
+  Fixed sy = y0 < y1 ? y0 : y1;
+  Fixed sw = (x0 < x1 ? x1 - x0 : x0 - x1) + w;
+  Fixed sh = (y0 < y1 ? y1 - y0 : y0 - y1) + h;
+  int c0, r0, c1, r1;
+  if (!getSwarmCellRange(originX, originY, sx, sy, sw, sh, &c0, &r0, &c1,
+                         &r1))
+    return -1;
+
+  Fixed ex[ENEMY_COLS], ey[ENEMY_COLS];
+  for (int col = 0; col < ENEMY_COLS; col++)
+    ex[col] = originX + FIXED(col * ENEMY_PITCH_X);
+
+  int best = -1;
+  Fixed bestToi = 2 * FIXED_ONE;
+  for (int row = r0; row <= r1; row++) {
+    // Only the living enemies of the candidate columns...
+    unsigned bits = alive->rows[row] & ((1u << (c1 + 1)) - (1u << c0));
+    if (!bits)
+      continue;
+
+    // ...whose box the path's bounding box overlaps (one SIMD test)
+    for (int col = 0; col < ENEMY_COLS; col++)
+      ey[col] = originY + FIXED(row * ENEMY_PITCH_Y);
+    bits &= overlapBoxes(sx, sy, sw, sh, ex, ey, FIXED(ENEMY_WIDTH),
+                         FIXED(ENEMY_HEIGHT), ENEMY_COLS);
+    for (; bits; bits &= bits - 1) {
+      int col = __builtin_ctz(bits);
+      Fixed t;
+      // Box first, then the opaque pixels (never earlier than the box).
+      // Row-major order: on a tie the first one found has the lowest index
+      if (sweepBox(x0, y0, x1, y1, w, h, ex[col], ey[col], FIXED(ENEMY_WIDTH),
+                   FIXED(ENEMY_HEIGHT), &t) &&
+          t < bestToi &&
+          sweepHitMask(mask, x0 - ex[col], y0 - ey[col], x1 - ex[col],
+                       y1 - ey[col], w, h, &t) &&
+          t < bestToi) {
+        best = row * ENEMY_COLS + col;
+        bestToi = t;
+      }
+    }
+  }
+  if (best >= 0)
+    *toi = bestToi;
+  return best;
+}
+
+Impact findImpact(const ImpactTargets *targets, Fixed x0, Fixed y0, Fixed x1,
+                  Fixed y1, Fixed w, Fixed h, Fixed velocityY) {
+  Impact impact = {IMPACT_NONE, 0, 2 * FIXED_ONE, 0, 0, 0};
+
+  // Bunkers block BOTH player and enemy fire
+  Fixed t;
+  int cx, cy;
+  if (targets->bunkers) {
+    int i = sweepBunkers(targets->bunkers, x0, y0, x1, y1, w, h,
+                         velocityY < 0, &t, &cx, &cy);
+    if (i >= 0)
+      impact = (Impact){IMPACT_BUNKER, i, t, cx, cy, 0};
+  }
+
+  if (velocityY < 0) {
+    // Player bullets: the boss (SWARM_BOSS), else the grid
+    if (targets->bossActive) {
+      Fixed bx = targets->bossX, by = targets->bossY;
+      if (sweepBox(x0, y0, x1, y1, w, h, bx, by, targets->bossWidth,
+                   targets->bossHeight, &t) &&
+          t < impact.toi &&
+          sweepHitMask(getHitMask(HIT_MASK_BOSS), x0 - bx, y0 - by, x1 - bx,
+                       y1 - by, w, h, &t) &&
+          t < impact.toi)
+        impact = (Impact){IMPACT_BOSS, 0, t, 0, 0, 0};
+    } else {
+      const HitMask *mask = getHitMask(
+          targets->animationFrame ? HIT_MASK_ALIEN_2 : HIT_MASK_ALIEN_1);
+      int j = sweepSwarmHit(targets->alive, targets->originX,
+                            targets->originY, mask, x0, y0, x1, y1, w, h, &t);
+      if (j >= 0 && t < impact.toi)
+        impact = (Impact){IMPACT_ENEMY, j, t, 0, 0, 0};
+    }
+  } else if (velocityY > 0) {
+    // Enemy bullets: the player
+    if (sweepBox(x0, y0, x1, y1, w, h, targets->playerX, targets->playerY,
+                 targets->playerWidth, targets->playerHeight, &t) &&
+        t < impact.toi)
+      impact = (Impact){IMPACT_PLAYER, 0, t, 0, 0, 0};
+  }
+  return impact;
+}
+
+/**
+ * @brief Flags the paths that may hit something, from heights alone: a
+ * path that overlaps neither the bunker rows nor the rows of its target
+ * (the grid or the Boss going up, the player going down) cannot hit, and
+ * findImpact() would find nothing. One branch-free loop over the arrays;
+ * the bands are widened by a pixel, a margin the exact compares of the
+ * full test do not need but that costs nothing.
+ */
+static void findImpactCandidates(const ImpactTargets *targets,
+                                 const Fixed *restrict y0,
+                                 const Fixed *restrict y1,
+                                 const Fixed *restrict velocityY, int count,
+                                 bool *restrict near) {
+  const BunkerManager *bm = targets->bunkers;
+  bool shields = bm != NULL;
+  Fixed bunkerTop = 0, bunkerBottom = 0;
+  if (shields) {
+    bunkerTop = bunkerBottom = bm->bunkers[0].y;
+    for (int k = 1; k < BUNKER_COUNT; k++) {
+      Fixed y = bm->bunkers[k].y;
+      bunkerTop = y < bunkerTop ? y : bunkerTop;
+      bunkerBottom = y > bunkerBottom ? y : bunkerBottom;
+    }
+  }
+  bunkerTop -= FIXED_ONE;
+  bunkerBottom += FIXED(BUNKER_PIXEL_HEIGHT + 1);
+
+  Fixed upTop = targets->originY;
+  Fixed upBottom = targets->originY +
+                   FIXED((ENEMY_ROWS - 1) * ENEMY_PITCH_Y + ENEMY_HEIGHT);
+  if (targets->bossActive) {
+    upTop = targets->bossY;
+    upBottom = targets->bossY + targets->bossHeight;
+  }
+  upTop -= FIXED_ONE;
+  upBottom += FIXED_ONE;
+  Fixed downTop = targets->playerY - FIXED_ONE;
+  Fixed downBottom = targets->playerY + targets->playerHeight + FIXED_ONE;
+
+  for (int k = 0; k < count; k++) {
+    Fixed top = y0[k] < y1[k] ? y0[k] : y1[k];
+    Fixed bottom =
+        (y0[k] < y1[k] ? y1[k] : y0[k]) + FIXED(PROJECTILE_HEIGHT);
+    Fixed targetTop = velocityY[k] < 0 ? upTop : downTop;
+    Fixed targetBottom = velocityY[k] < 0 ? upBottom : downBottom;
+    near[k] = (shields & (top <= bunkerBottom) & (bottom >= bunkerTop)) |
+              ((top <= targetBottom) & (bottom >= targetTop));
+  }
+}
+
+int findImpacts(const ImpactTargets *targets, const Fixed *x0,
+                const Fixed *y0, const Fixed *x1, const Fixed *y1,
+                const Fixed *velocityY, int count, Impact *impacts) {
+  // Most bullets fly through empty rows of the screen: one pass over the
+  // heights keeps those whose path reaches a target's band
+  bool near[MAX_PROJECTILES];
+  findImpactCandidates(targets, y0, y1, velocityY, count, near);
+
+  int pending = 0;
+  for (int k = 0; k < count; k++) {
+    if (!near[k])
+      continue;
+    impacts[pending] =
+        findImpact(targets, x0[k], y0[k], x1[k], y1[k],
+                   FIXED(PROJECTILE_WIDTH), FIXED(PROJECTILE_HEIGHT),
+                   velocityY[k]);
+    impacts[pending].slot = k;
+    pending += impacts[pending].kind != IMPACT_NONE;
+  }
+  return pending;
+}
+
+bool isSameImpact(const Impact *a, const Impact *b) {
+  return a->kind == b->kind && a->target == b->target && a->toi == b->toi &&
+         a->x == b->x && a->y == b->y;
+}
+
+int nextImpact(const Impact *impacts, int count) {
+  int next = -1;
+  for (int i = 0; i < count; i++) {
+    if (next < 0 || impacts[i].toi < impacts[next].toi ||
+        (impacts[i].toi == impacts[next].toi &&
+         impacts[i].slot < impacts[next].slot))
+      next = i;
+  }
+  return next;
+}
+
+/** @brief findImpact() for the path of bullet `i` of the pool. */
+static Impact findProjectileImpact(const ImpactTargets *targets,
+                                   const Projectiles *projectiles, int i) {
+  return findImpact(targets, projectiles->prevX[i], projectiles->prevY[i],
+                    projectiles->x[i], projectiles->y[i],
+                    FIXED(PROJECTILE_WIDTH), FIXED(PROJECTILE_HEIGHT),
+                    projectiles->velocityY[i]);
+}
+
+/** @brief The grid is the target (the Boss fields stay cleared). */
+static void aimAtGrid(ImpactTargets *targets, const Swarm *swarm) {
+  targets->alive = &swarm->alive;
+  targets->originX = swarm->originX;
+  targets->originY = swarm->originY;
+  targets->animationFrame = swarm->animationFrame;
+}
+
+/** @brief The Boss is the target, while it lives (the grid is empty). */
+static void aimAtBoss(ImpactTargets *targets, const Swarm *swarm) {
+  aimAtGrid(targets, swarm);
+  targets->bossActive = swarm->boss.active;
+  targets->bossX = swarm->boss.x;
+  targets->bossY = swarm->boss.y;
+  targets->bossWidth = swarm->boss.width;
+  targets->bossHeight = swarm->boss.height;
+}
+
+/** @brief What player bullets can hit, per SwarmKind. */
+static void (*const aimAtSwarm[SWARM_KIND_COUNT])(ImpactTargets *,
+                                                  const Swarm *) = {
+    [SWARM_GRID] = aimAtGrid,
+    [SWARM_BOSS] = aimAtBoss,
+};
+
 bool checkCollisions(Player *player, Swarm *swarm, Projectiles *projectiles,
                      ExplosionManager *explosions, BunkerManager *bunkers,
-                     bool *enemyHit) {
+                     bool *enemyHit, TimerTime now) {
   if (!player || !swarm || !projectiles)
     return false;
 
@@ -23,86 +350,104 @@ bool checkCollisions(Player *player, Swarm *swarm, Projectiles *projectiles,
   if (enemyHit)
     *enemyHit = false;
 
-  // Iterate through all active projectiles (bullets)
-  for (int i = 0; i < MAX_PROJECTILES; i++) {
-    Projectile *p = &projectiles->projectiles[i];
+  ImpactTargets targets = {0};
+  targets.bunkers = bunkers;
+  targets.playerX = player->x;
+  targets.playerY = player->y;
+  targets.playerWidth = FIXED(player->width);
+  targets.playerHeight = FIXED(player->height);
+  aimAtSwarm[swarm->kind](&targets, swarm);
 
-    if (!p->active)
-      continue; // Skip unused bullet slots
+  // The live projectiles (bullets) that would hit something
+  Impact impacts[MAX_PROJECTILES];
+  int count = (int)projectiles->count;
+  int pending = findImpacts(&targets, projectiles->prevX, projectiles->prevY,
+                            projectiles->x, projectiles->y,
+                            projectiles->velocityY, count, impacts);
 
-    // --- CHECK 1: PROJECTILE VS BUNKERS ---
-    // Bunkers block BOTH player and enemy fire.
-    // If a bullet hits a bunker, it is destroyed immediately, so we 'continue'
-    // to the next bullet.
-    if (bunkers && checkBunkerCollision(bunkers, p)) {
-      continue;
-    }
+  // Earliest hit first. Bullets are only removed at the end, so that the
+  // slots of the pending impacts stay valid.
+  bool hit[MAX_PROJECTILES] = {false};
+  bool changed = false;
+  bool playerDied = false;
+  while (pending > 0 && !playerDied) {
+    int next = nextImpact(impacts, pending);
+    Impact impact = impacts[next];
 
-    // --- CHECK 2: PLAYER BULLETS (Moving UP) ---
-    if (p->velocityY < 0) {
+    // An earlier hit may have removed the target: look again
+    if (changed) {
+      impact = findProjectileImpact(&targets, projectiles, impact.slot);
+      impact.slot = impacts[next].slot;
+      if (!isSameImpact(&impact, &impacts[next])) {
+        impacts[next] = impact;
+        if (impact.kind == IMPACT_NONE)
+          impacts[next] = impacts[--pending];
+        continue;
+      }
+    }
+    impacts[next] = impacts[--pending];
+    hit[impact.slot] = true; // Destroy bullet
+    changed = true;
 
-      // A: BOSS COLLISION (Level 2+)
-      if (swarm->level == 2 && swarm->boss.active) {
-        if (checkOverlap(p->x, p->y, p->w, p->h, swarm->boss.x, swarm->boss.y,
-                         swarm->boss.width, swarm->boss.height)) {
+    switch (impact.kind) {
+    // --- PROJECTILE VS BUNKERS: the shield erodes ---
+    case IMPACT_BUNKER:
+      blastBunkerCrater(&bunkers->bunkers[impact.target], impact.x, impact.y);
+      break;
 
-          p->active = false;    // Destroy bullet
-          swarm->boss.health--; // Damage Boss
+    // --- PLAYER BULLETS VS BOSS (SWARM_BOSS) ---
+    case IMPACT_BOSS:
+      swarm->boss.health--; // Damage Boss
 
-          // Check for Boss Death
-          if (swarm->boss.health <= 0) {
-            swarm->boss.active = false;
-            player->score += 1000; // Big points for Boss
+      // Check for Boss Death
+      if (swarm->boss.health <= 0) {
+        swarm->boss.active = false;
+        targets.bossActive = false;
+        player->score += 1000; // Big points for Boss
 
-            if (explosions)
-              spawnExplosion(explosions, swarm->boss.x, swarm->boss.y);
+        if (explosions)
+          spawnExplosion(explosions, swarm->boss.x, swarm->boss.y, now);
 
-            if (enemyHit)
-              *enemyHit = true; // Trigger explosion sound
-          }
-        }
-      }
-      // B: STANDARD SWARM COLLISION (Level 1)
-      else {
-        for (int j = 0; j < TOTAL_ENEMIES; j++) {
-          Enemy *e = &swarm->enemies[j];
-
-          // Only check collision against ALIVE enemies
-          if (e->active && checkOverlap(p->x, p->y, p->w, p->h, e->x, e->y,
-                                        e->width, e->height)) {
-            p->active = false; // Destroy bullet
-            e->active = false; // Destroy enemy
-            player->score += e->killScore;
-
-            if (explosions) {
-              spawnExplosion(explosions, e->x, e->y);
-            }
-            if (enemyHit)
-              *enemyHit = true; // Trigger explosion sound
-
-            break; // Bullet can only hit one enemy, stop checking this bullet
-          }
-        }
+        if (enemyHit)
+          *enemyHit = true; // Trigger explosion sound
       }
-    }
+      break;
 
-    // --- CHECK 3: ENEMY BULLETS (Moving DOWN) ---
-    else if (p->velocityY > 0) {
-      // Check vs Player
-      if (checkOverlap(p->x, p->y, p->w, p->h, player->x, player->y,
-                       player->width, player->height)) {
+    // --- PLAYER BULLETS VS SWARM (SWARM_GRID) ---
+    case IMPACT_ENEMY: {
+      Enemy *e = &swarm->enemies[impact.target];
+      killSwarmEnemy(swarm, impact.target); // Destroy enemy
+      player->score += e->killScore;
 
-        p->active = false; // Destroy bullet
+      if (explosions) {
+        spawnExplosion(explosions, getEnemyX(swarm, impact.target),
+                       getEnemyY(swarm, impact.target), now);
+      }
+      if (enemyHit)
+        *enemyHit = true; // Trigger explosion sound
+      break;
+    }
 
-        if (player->health > 0) {
-          player->health--;
-          printf("Player Hit! Health: %d\n", player->health);
+    // --- ENEMY BULLETS VS PLAYER ---
+    case IMPACT_PLAYER:
+      if (player->health > 0) {
+        player->health--;
 
-          if (player->health == 0)
-            return true; // Return TRUE indicates Game Over (Player Died)
-        }
+        if (player->health == 0)
+          playerDied = true; // Game Over (Player Died)
       }
+      break;
+
+    case IMPACT_NONE:
+      break;
     }
   }
-  return false; // Player survived this frame
-}
\ No newline at end of file
+
+  // Swap-remove from the highest slot down: the bullet moved into a freed
+  // slot is never one that still has to go
+  for (int i = count - 1; i >= 0; i--) {
+    if (hit[i])
+      killProjectile(projectiles, (unsigned)i);
+  }
+  return playerDied; // TRUE indicates Game Over
+}
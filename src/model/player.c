@@ -1,33 +1,42 @@
+#include "../../includes/sim_float.h"
 #include "../../includes/player.h"
 #include <stdbool.h>
 #include <stdlib.h>
 
-Player *createPlayer(float xAxis, unsigned height, unsigned width) {
+Player *createPlayer(Fixed xAxis, unsigned height, unsigned width) {
   // Use calloc to ensure all fields (score, timers) start at 0
   Player *p = (Player *)calloc(1, sizeof(Player));
   if (!p) {
     return NULL;
   }
 
+  initPlayer(p, xAxis, height, width);
+  return p;
+}
+
+void initPlayer(Player *p, Fixed xAxis, unsigned height, unsigned width) {
+  if (!p) {
+    return;
+  }
+
   // Set initial game state
   p->health = HEALTH;
-  p->shootTimer = 0.0f;
+  p->shootReadyAt = 0; // Ready at once
 
   // Set physics state
-  p->velocityX = 0.0f;
+  p->velocityX = 0;
   p->width = width;
   p->height = height;
   p->x = xAxis;
   p->y = Y_AXIS; // Fixed vertical position
 
   p->score = 0;
+  p->highScore = 0;
 
   // Set animation state
-  p->animTimer = 0.0f;
+  p->animAt = secondsToTimer(PLAYER_ANIM_PERIOD);
   p->animFrame = 0;
   p->animDir = 1; // Start animating forward
-
-  return p;
 }
 
 void destroyPlayer(Player *player) {
@@ -42,9 +51,9 @@ void setPlayerDirection(Player *player, Direction direction) {
     return;
   }
 
-  // Map input Enum to actual Velocity float
+  // Map input Enum to actual Velocity
   if (direction == MOVE_NONE) {
-    player->velocityX = 0.0f;
+    player->velocityX = 0;
   } else if (direction == MOVE_LEFT) {
     player->velocityX = -PLAYER_SPEED;
   } else {
@@ -52,33 +61,27 @@ void setPlayerDirection(Player *player, Direction direction) {
   }
 }
 
-void updatePlayer(Player *player, float deltaTime, unsigned screenWidth) {
+void updatePlayer(Player *player, Fixed deltaTime, TimerTime now,
+                  unsigned screenWidth) {
   if (!player) {
     return;
   }
 
   // --- 1. Physics Update ---
-  player->x += player->velocityX * deltaTime;
+  player->x += fixedMul(player->velocityX, deltaTime);
 
   // Clamp Position: Keep player inside screen bounds (0 to Width)
+  Fixed maxX = FIXED((int)screenWidth - (int)player->width);
   if (player->x < 0) {
     player->x = 0;
   }
-  if (player->x > screenWidth - player->width) {
-    player->x = screenWidth - player->width;
-  }
-
-  // --- 2. Cooldown Update ---
-  if (player->shootTimer > 0) {
-    player->shootTimer -= deltaTime;
-    if (player->shootTimer < 0)
-      player->shootTimer = 0;
+  if (player->x > maxX) {
+    player->x = maxX;
   }
 
-  // --- 3. Animation Update (Idle Exhaust) ---
-  player->animTimer += deltaTime;
-  if (player->animTimer >= 0.3f) { // Toggle frame every 0.3 seconds
-    player->animTimer = 0.0f;
+  // --- 2. Animation Update (Idle Exhaust) ---
+  if (now >= player->animAt) { // Toggle frame every PLAYER_ANIM_PERIOD
+    player->animAt = now + secondsToTimer(PLAYER_ANIM_PERIOD);
     player->animFrame += player->animDir;
 
     // Ping-Pong Animation Logic: 0 -> 1 -> 2 -> 3 -> 2 -> 1 -> 0
@@ -92,36 +95,36 @@ void updatePlayer(Player *player, float deltaTime, unsigned screenWidth) {
   }
 }
 
-bool canPlayerShoot(Player *player) {
+bool canPlayerShoot(Player *player, TimerTime now) {
   if (!player)
     return false;
 
-  if (player->shootTimer == 0) {
-    player->shootTimer = PLAYER_SHOOT_COOLDOWN;
+  if (now >= player->shootReadyAt) {
+    player->shootReadyAt = now + secondsToTimer(PLAYER_SHOOT_COOLDOWN);
     return true;
   }
   return false;
 }
 
-bool playerShoot(Player *player, Projectiles *projectiles) {
+bool playerShoot(Player *player, Projectiles *projectiles, TimerTime now) {
   if (!player || !projectiles)
     return false;
 
   // 1. Check Cooldown
-  if (player->shootTimer <= 0.0f) {
+  if (now >= player->shootReadyAt) {
 
     // 2. Calculate Position (Center the bullet on the player sprite)
     // Formula: PlayerX + (Half Player Width) - (Half Bullet Width)
-    float bulletX =
-        player->x + (player->width / 2.0f) - (PROJECTILE_WIDTH / 2.0f);
+    Fixed bulletX = player->x + FIXED(player->width) / 2 -
+                    FIXED(PROJECTILE_WIDTH) / 2;
 
-    float bulletY = player->y; // Spawn at top of player
+    Fixed bulletY = player->y; // Spawn at top of player
 
     // 3. Fire! (Spawn projectile moving UP)
     spawnProjectile(projectiles, bulletX, bulletY, MOVE_UP);
 
     // 4. Reset Cooldown
-    player->shootTimer = PLAYER_SHOOT_COOLDOWN;
+    player->shootReadyAt = now + secondsToTimer(PLAYER_SHOOT_COOLDOWN);
 
     return true;
   }
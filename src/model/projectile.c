@@ -1,22 +1,31 @@
+#include "../../includes/sim_float.h"
 #include "../../includes/projectile.h"
 #include <stdlib.h>
 
-Projectiles *createProjectiles(unsigned count) {
-  // Allocate memory for the Manager + Array of Projectiles
+Projectiles *createProjectiles(unsigned capacity) {
+  // Allocate memory for the Manager + Arrays of Projectiles
   // Using calloc ensures everything starts at 0 (NULL/false)
   Projectiles *projectiles = (Projectiles *)calloc(1, sizeof(Projectiles));
   if (!projectiles) {
     return NULL;
   }
 
-  // Initialize the Object Pool
-  projectiles->count = MAX_PROJECTILES;
-  for (unsigned i = 0; i < projectiles->count; i++) {
-    projectiles->projectiles[i].active = false; // Mark all slots as "Free"
-  }
+  initProjectiles(projectiles, capacity);
   return projectiles;
 }
 
+void initProjectiles(Projectiles *projectiles, unsigned capacity) {
+  if (!projectiles) {
+    return;
+  }
+
+  // Initialize the Object Pool: no live bullet, all slots "Free"
+  if (capacity == 0 || capacity > MAX_PROJECTILES)
+    capacity = MAX_PROJECTILES;
+  projectiles->capacity = capacity;
+  projectiles->count = 0;
+}
+
 void destroyProjectiles(Projectiles *projectiles) {
   if (!projectiles) {
     return;
@@ -24,76 +33,105 @@ void destroyProjectiles(Projectiles *projectiles) {
   free(projectiles);
 }
 
-void spawnProjectile(Projectiles *projectiles, float x, float y,
+void getProjectileVelocity(DirectionProjectile direction, Fixed *vx,
+                           Fixed *vy) {
+  *vx = 0; // Default horizontal speed
+
+  if (direction == MOVE_UP) {
+    // Player shoots UP (Negative Y)
+    *vy = -PROJECTILE_SPEED;
+  } else if (direction == MOVE_DOWN) {
+    // Enemies shoot DOWN (Positive Y)
+    *vy = PROJECTILE_SPEED;
+  }
+  // Boss Special Attacks (Diagonal)
+  else if (direction == MOVE_DOWN_LEFT) {
+    *vx = -PROJECTILE_SPREAD_SPEED;
+    *vy = PROJECTILE_SPEED;
+  } else if (direction == MOVE_DOWN_RIGHT) {
+    *vx = PROJECTILE_SPREAD_SPEED;
+    *vy = PROJECTILE_SPEED;
+  } else {
+    *vy = 0;
+  }
+}
+
+bool spawnProjectile(Projectiles *projectiles, Fixed x, Fixed y,
                      DirectionProjectile direction) {
+  return spawnProjectiles(projectiles, x, y, &direction, 1) == 1;
+}
+
+unsigned spawnProjectiles(Projectiles *projectiles, Fixed x, Fixed y,
+                          const DirectionProjectile *directions, unsigned n) {
   if (!projectiles) {
-    return;
+    return 0;
   }
-  unsigned i;
-  // Iterate through the pool to find the first available slot
-  for (i = 0; i < projectiles->count; i++) {
-    if (!projectiles->projectiles[i].active) {
-      // --- Initialize Bullet State ---
-      projectiles->projectiles[i].x = x;
-      projectiles->projectiles[i].y = y;
-      projectiles->projectiles[i].velocityX = 0.0f; // Default horizontal speed
-
-      // --- Velocity Logic ---
-      if (direction == MOVE_UP) {
-        // Player shoots UP (Negative Y)
-        projectiles->projectiles[i].velocityY = -PROJECTILE_SPEED;
-      } else if (direction == MOVE_DOWN) {
-        // Enemies shoot DOWN (Positive Y)
-        projectiles->projectiles[i].velocityY = PROJECTILE_SPEED;
-      }
-      // Boss Special Attacks (Diagonal)
-      else if (direction == MOVE_DOWN_LEFT) {
-        projectiles->projectiles[i].velocityX = -150.0f;
-        projectiles->projectiles[i].velocityY = PROJECTILE_SPEED;
-      } else if (direction == MOVE_DOWN_RIGHT) {
-        projectiles->projectiles[i].velocityX = 150.0f;
-        projectiles->projectiles[i].velocityY = PROJECTILE_SPEED;
-      } else {
-        projectiles->projectiles[i].velocityY = 0.0f;
-      }
-
-      // Set Hitbox dimensions
-      projectiles->projectiles[i].w = PROJECTILE_WIDTH;
-      projectiles->projectiles[i].h = PROJECTILE_HEIGHT;
-
-      // Activate the bullet
-      projectiles->projectiles[i].active = true;
-      break; // Exit loop (spawned one bullet)
-    }
+
+  // The free slots start at `count`
+  unsigned room = projectiles->capacity - projectiles->count;
+  if (n > room)
+    n = room;
+
+  for (unsigned k = 0; k < n; k++) {
+    unsigned i = projectiles->count + k;
+    projectiles->x[i] = x;
+    projectiles->y[i] = y;
+    projectiles->prevX[i] = x; // No path flown yet
+    projectiles->prevY[i] = y;
+    getProjectileVelocity(directions[k], &projectiles->velocityX[i],
+                          &projectiles->velocityY[i]);
   }
+  projectiles->count += n;
+  return n;
 }
 
-void updateProjectiles(Projectiles *projectiles, float deltaTime,
+void killProjectile(Projectiles *projectiles, unsigned index) {
+  if (!projectiles || index >= projectiles->count) {
+    return;
+  }
+
+  // Swap-remove: the last bullet takes the freed slot
+  unsigned last = --projectiles->count;
+  projectiles->x[index] = projectiles->x[last];
+  projectiles->y[index] = projectiles->y[last];
+  projectiles->velocityX[index] = projectiles->velocityX[last];
+  projectiles->velocityY[index] = projectiles->velocityY[last];
+  projectiles->prevX[index] = projectiles->prevX[last];
+  projectiles->prevY[index] = projectiles->prevY[last];
+}
+
+void updateProjectiles(Projectiles *projectiles, Fixed deltaTime,
                        unsigned screenHeight) {
   if (!projectiles) {
     return;
   }
 
-  // Update Physics for all ACTIVE bullets
-  for (unsigned i = 0; i < projectiles->count; i++) {
-    if (projectiles->projectiles[i].active) {
-
-      // 1. Apply Velocity
-      projectiles->projectiles[i].y +=
-          projectiles->projectiles[i].velocityY * deltaTime;
-      projectiles->projectiles[i].x +=
-          projectiles->projectiles[i].velocityX * deltaTime;
-
-      // 2. Boundary Check (Garbage Collection)
-      // If bullet goes off-screen (Top, Bottom, Left, or Right), deactivate it.
-      if (projectiles->projectiles[i].y < 0 ||
-          projectiles->projectiles[i].y > screenHeight ||
-          projectiles->projectiles[i].x < 0 ||
-          projectiles->projectiles[i].x >
-              800) { // Hardcoded 800 width assumption
-
-        projectiles->projectiles[i].active = false; // Return to pool
-      }
+  // 1. Boundary Check (Garbage Collection)
+  // A bullet that went off-screen (Top, Bottom, Left, or Right) during the
+  // previous step has been through its last collision pass.
+  Fixed bottom = FIXED(screenHeight);
+  for (unsigned i = 0; i < projectiles->count;) {
+    Fixed x = projectiles->x[i], y = projectiles->y[i];
+    if (y < 0 || y > bottom || x < 0 ||
+        x > FIXED(800)) { // Hardcoded 800 width assumption
+      killProjectile(projectiles, i); // Slot i now holds another bullet
+    } else {
+      i++;
     }
   }
-}
\ No newline at end of file
+
+  // 2. Apply Velocity (only live slots: one vectorizable loop)
+  Fixed *restrict x = projectiles->x;
+  Fixed *restrict y = projectiles->y;
+  Fixed *restrict prevX = projectiles->prevX;
+  Fixed *restrict prevY = projectiles->prevY;
+  const Fixed *restrict vx = projectiles->velocityX;
+  const Fixed *restrict vy = projectiles->velocityY;
+  unsigned count = projectiles->count;
+  for (unsigned i = 0; i < count; i++) {
+    prevX[i] = x[i];
+    prevY[i] = y[i];
+    x[i] += fixedMul(vx[i], deltaTime);
+    y[i] += fixedMul(vy[i], deltaTime);
+  }
+}
@@ -0,0 +1,550 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/raster.h"
+#include "../../includes/sprite_masks.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// ==========================================
+//               CONSTANTS
+// ==========================================
+
+/** @brief Period of a fill pattern: 16 RGB pixels or 48 gray pixels. */
+#define RASTER_PATTERN_PERIOD 48
+
+/** @brief Stored pattern bytes: one period plus room for an unaligned load. */
+#define RASTER_PATTERN_SIZE (RASTER_PATTERN_PERIOD + 16)
+
+/** @brief Coverage (0..255) from which a scaled texel is drawn. */
+#define RASTER_OPAQUE 128
+
+/**
+ * @brief Widest bunker drawn, in output pixels (a bunker spans a tenth of
+ * an 800-unit screen, so this covers 10x upscaled frames).
+ */
+#define RASTER_BUNKER_MAX_WIDTH 1024
+
+/** @brief Boss health bar geometry, as in renderSDL(). */
+#define RASTER_HEALTH_OFFSET 15.0f
+#define RASTER_HEALTH_HEIGHT 10.0f
+
+/** @brief Colors used besides the sprite colors. */
+enum {
+  RASTER_HEALTH_BACK = SPRITE_COUNT,
+  RASTER_HEALTH_FRONT,
+  RASTER_COLOR_COUNT
+};
+
+/**
+ * @brief R, G, B and gray level of every sprite.
+ * Gray levels are picked by hand so that every kind of entity stays
+ * distinguishable in a grayscale observation.
+ */
+static const uint8_t rasterPalette[RASTER_COLOR_COUNT][4] = {
+    [SPRITE_PLAYER] = {64, 160, 255, 170},
+    [SPRITE_ALIEN_1] = {255, 255, 255, 255},
+    [SPRITE_ALIEN_2] = {255, 255, 255, 255},
+    [SPRITE_BOSS] = {255, 48, 48, 200},
+    [SPRITE_BULLET_PLAYER] = {255, 255, 0, 230},
+    [SPRITE_BULLET_ENEMY] = {255, 64, 255, 140},
+    [SPRITE_BUNKER] = {0, 200, 0, 90},
+    [SPRITE_EXPLOSION_1] = {255, 160, 0, 120},
+    [SPRITE_EXPLOSION_2] = {255, 160, 0, 120},
+    [SPRITE_EXPLOSION_3] = {255, 160, 0, 120},
+    [RASTER_HEALTH_BACK] = {255, 0, 0, 60},
+    [RASTER_HEALTH_FRONT] = {0, 255, 0, 210},
+};
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/** @brief One horizontal run of opaque pixels, relative to the sprite. */
+typedef struct {
+  int16_t y;
+  int16_t x;
+  int16_t length;
+} RasterSpan;
+
+/** @brief A mask scaled to the pixel size of its entity. */
+typedef struct {
+  int width;  /**< Pixel width, 0 while not built. */
+  int height; /**< Pixel height. */
+  bool solid; /**< Every texel is opaque: the sprite is a plain rectangle. */
+  int spanCount;
+  RasterSpan *spans;
+} ScaledSprite;
+
+struct Rasterizer {
+  int width;
+  int height;
+  RasterFormat format;
+  float scaleX; /**< Output pixels per logical pixel. */
+  float scaleY;
+  ScaledSprite sprites[SPRITE_COUNT];
+
+  /** @brief Each color repeated over RASTER_PATTERN_SIZE bytes. */
+  _Alignas(16) uint8_t patterns[RASTER_COLOR_COUNT][RASTER_PATTERN_SIZE];
+};
+
+// ==========================================
+//               SPRITE SCALING
+// ==========================================
+
+/**
+ * @brief Box-filters a mask down (or samples it up) to width x height and
+ * stores its opaque texels as spans.
+ * A sprite whose every texel falls under RASTER_OPAQUE keeps its densest
+ * texel, so that no entity ever vanishes from a small observation.
+ */
+static bool buildSprite(ScaledSprite *sprite, SpriteId id, int width,
+                        int height) {
+  const uint8_t *mask = spriteMasks[id];
+  int maxSpans = height * ((width + 1) / 2);
+  RasterSpan *spans = (RasterSpan *)malloc(maxSpans * sizeof(RasterSpan));
+  if (!spans)
+    return false;
+
+  int count = 0;
+  int bestX = 0, bestY = 0, bestCoverage = -1;
+
+  for (int y = 0; y < height; y++) {
+    int y0 = y * SPRITE_MASK_SIZE / height;
+    int y1 = (y + 1) * SPRITE_MASK_SIZE / height;
+    if (y1 <= y0)
+      y1 = y0 + 1;
+
+    int runStart = -1;
+    for (int x = 0; x <= width; x++) {
+      bool opaque = false;
+      if (x < width) {
+        int x0 = x * SPRITE_MASK_SIZE / width;
+        int x1 = (x + 1) * SPRITE_MASK_SIZE / width;
+        if (x1 <= x0)
+          x1 = x0 + 1;
+
+        int sum = 0;
+        for (int my = y0; my < y1; my++)
+          for (int mx = x0; mx < x1; mx++)
+            sum += mask[my * SPRITE_MASK_SIZE + mx];
+        int coverage = sum / ((y1 - y0) * (x1 - x0));
+
+        opaque = coverage >= RASTER_OPAQUE;
+        if (coverage > bestCoverage) {
+          bestCoverage = coverage;
+          bestX = x;
+          bestY = y;
+        }
+      }
+
+      if (opaque && runStart < 0) {
+        runStart = x;
+      } else if (!opaque && runStart >= 0) {
+        spans[count++] = (RasterSpan){(int16_t)y, (int16_t)runStart,
+                                      (int16_t)(x - runStart)};
+        runStart = -1;
+      }
+    }
+  }
+
+  if (count == 0)
+    spans[count++] = (RasterSpan){(int16_t)bestY, (int16_t)bestX, 1};
+
+  bool solid = count == height;
+  for (int i = 0; i < count && solid; i++)
+    solid = spans[i].x == 0 && spans[i].length == width;
+
+  free(sprite->spans);
+  sprite->solid = solid;
+  sprite->spans = spans;
+  sprite->spanCount = count;
+  sprite->width = width;
+  sprite->height = height;
+  return true;
+}
+
+/** @brief Converts a logical length to a pixel length (at least 1). */
+static inline int toPixels(float length, float scale) {
+  int pixels = (int)(length * scale + 0.5f);
+  return pixels > 0 ? pixels : 1;
+}
+
+/** @brief Converts a logical coordinate to the nearest pixel coordinate. */
+static inline int toPixel(float position, float scale) {
+  float v = position * scale + 0.5f;
+  int pixel = (int)v;
+  return pixel - (v < (float)pixel); // floor() for negative positions
+}
+
+/**
+ * @brief Returns the sprite `id` scaled for an entity of w x h logical
+ * pixels, rebuilding it only if that size changed since the last frame.
+ */
+static const ScaledSprite *getSprite(Rasterizer *raster, SpriteId id,
+                                     float w, float h) {
+  ScaledSprite *sprite = &raster->sprites[id];
+  int width = toPixels(w, raster->scaleX);
+  int height = toPixels(h, raster->scaleY);
+
+  if (sprite->width != width || sprite->height != height) {
+    if (!buildSprite(sprite, id, width, height))
+      return NULL;
+  }
+  return sprite;
+}
+
+// ==========================================
+//               SPAN FILLING
+// ==========================================
+
+/**
+ * @brief Fills `bytes` bytes starting on a pixel boundary with a color
+ * pattern.
+ * The pattern period (48 bytes) is a multiple of 16 and of every pixel size,
+ * so long spans are 16-byte stores of the pattern lanes in turn, finished
+ * by one overlapping store. Short spans use two overlapping fixed-size
+ * moves (constant-size memcpy compiles to a single load/store): no loop
+ * and no library call for the typical 1-10 pixel span of a small
+ * observation.
+ */
+static inline void fillSpan(uint8_t *dst, int bytes, const uint8_t *pattern) {
+  if (bytes >= 16) {
+    uint8_t *end = dst + bytes;
+    int lane = 0;
+    while (end - dst >= 16) {
+#ifdef __SSE2__
+      _mm_storeu_si128((__m128i *)dst,
+                       _mm_load_si128((const __m128i *)(pattern + lane)));
+#else
+      memcpy(dst, pattern + lane, 16);
+#endif
+      dst += 16;
+      lane = (lane == 32) ? 0 : lane + 16;
+    }
+    if (dst < end) {
+      // Last 16 bytes, overlapping the previous store
+      int offset = lane - (int)(16 - (end - dst));
+      if (offset < 0)
+        offset += RASTER_PATTERN_PERIOD;
+#ifdef __SSE2__
+      _mm_storeu_si128((__m128i *)(end - 16),
+                       _mm_loadu_si128((const __m128i *)(pattern + offset)));
+#else
+      memcpy(end - 16, pattern + offset, 16);
+#endif
+    }
+  } else if (bytes >= 8) {
+    memcpy(dst, pattern, 8);
+    memcpy(dst + bytes - 8, pattern + bytes - 8, 8);
+  } else if (bytes >= 4) {
+    memcpy(dst, pattern, 4);
+    memcpy(dst + bytes - 4, pattern + bytes - 4, 4);
+  } else if (bytes >= 2) {
+    memcpy(dst, pattern, 2);
+    memcpy(dst + bytes - 2, pattern + bytes - 2, 2);
+  } else if (bytes == 1) {
+    *dst = pattern[0];
+  }
+}
+
+/** @brief Fills [x0, x1) of row y, clipped to the frame. */
+static inline void fillRow(const Rasterizer *raster, uint8_t *pixels, int y,
+                           int x0, int x1, const uint8_t *pattern) {
+  if (y < 0 || y >= raster->height)
+    return;
+  if (x0 < 0)
+    x0 = 0;
+  if (x1 > raster->width)
+    x1 = raster->width;
+  if (x1 <= x0)
+    return;
+
+  int bpp = (int)raster->format;
+  fillSpan(pixels + ((size_t)y * raster->width + x0) * bpp, (x1 - x0) * bpp,
+           pattern);
+}
+
+/** @brief Draws the spans of a scaled sprite with its top-left at (px, py). */
+static void drawSpans(const Rasterizer *raster, uint8_t *pixels,
+                      const ScaledSprite *sprite, const uint8_t *pattern,
+                      int px, int py) {
+  if (px >= raster->width || py >= raster->height ||
+      px + sprite->width <= 0 || py + sprite->height <= 0)
+    return;
+
+  if (px < 0 || py < 0 || px + sprite->width > raster->width ||
+      py + sprite->height > raster->height) {
+    for (int i = 0; i < sprite->spanCount; i++) {
+      const RasterSpan *span = &sprite->spans[i];
+      int x0 = px + span->x;
+      fillRow(raster, pixels, py + span->y, x0, x0 + span->length, pattern);
+    }
+    return;
+  }
+
+  // Fully inside the frame: no clipping per span
+  int bpp = (int)raster->format;
+  size_t pitch = (size_t)raster->width * bpp;
+  uint8_t *origin = pixels + (size_t)py * pitch + (size_t)px * bpp;
+  for (int i = 0; i < sprite->spanCount; i++) {
+    const RasterSpan *span = &sprite->spans[i];
+    fillSpan(origin + span->y * pitch + span->x * bpp, span->length * bpp,
+             pattern);
+  }
+}
+
+/** @brief Draws a scaled sprite with its top-left at logical (x, y). */
+static void drawScaled(const Rasterizer *raster, uint8_t *pixels,
+                       const ScaledSprite *sprite, const uint8_t *pattern,
+                       float x, float y) {
+  drawSpans(raster, pixels, sprite, pattern, toPixel(x, raster->scaleX),
+            toPixel(y, raster->scaleY));
+}
+
+/**
+ * @brief Bunker pixel sampled by output pixel `o` (nearest: the one under
+ * its centre), for a bunker whose edge lies at logical coordinate `origin`.
+ */
+static inline int samplePixel(int o, float inverseScale, float origin) {
+  return (int)(((float)o + 0.5f) * inverseScale - origin);
+}
+
+/**
+ * @brief Draws the damage bitmap of one bunker.
+ * Every output pixel samples the bunker pixel under its centre (a plain
+ * bit test), like a nearest-filtered texture; lit pixels of a row are
+ * merged into spans.
+ */
+static void drawBunker(const Rasterizer *raster, uint8_t *pixels,
+                       const Bunker *bunker, const uint8_t *pattern) {
+  float x = fixedToFloat(bunker->x), y = fixedToFloat(bunker->y);
+  int ox0 = toPixel(x, raster->scaleX);
+  int ox1 = toPixel(x + BUNKER_PIXEL_WIDTH, raster->scaleX);
+  int oy0 = toPixel(y, raster->scaleY);
+  int oy1 = toPixel(y + BUNKER_PIXEL_HEIGHT, raster->scaleY);
+  if (ox0 < 0)
+    ox0 = 0;
+  if (ox1 > raster->width)
+    ox1 = raster->width;
+  float inverseX = 1.0f / raster->scaleX;
+  float inverseY = 1.0f / raster->scaleY;
+
+  // The sampled columns are the same for every row (-1: off the bitmap)
+  int16_t columns[RASTER_BUNKER_MAX_WIDTH];
+  if (ox1 - ox0 > RASTER_BUNKER_MAX_WIDTH)
+    ox1 = ox0 + RASTER_BUNKER_MAX_WIDTH;
+  for (int ox = ox0; ox < ox1; ox++) {
+    int px = samplePixel(ox, inverseX, x);
+    columns[ox - ox0] = px >= 0 && px < BUNKER_PIXEL_WIDTH ? px : -1;
+  }
+
+  // Runs of lit output pixels of the last sampled row: rows of the bitmap
+  // are often identical (intact blocks), and then so are their runs
+  int16_t runStart[RASTER_BUNKER_MAX_WIDTH / 2 + 1];
+  int16_t runEnd[RASTER_BUNKER_MAX_WIDTH / 2 + 1];
+  int runCount = 0;
+  const BunkerRow *lastRow = NULL;
+
+  for (int oy = oy0; oy < oy1; oy++) {
+    int py = samplePixel(oy, inverseY, y);
+    if (py < 0 || py >= BUNKER_PIXEL_HEIGHT)
+      continue;
+    const BunkerRow *row = bunker->pixels[py];
+
+    if (!lastRow || memcmp(row, lastRow, sizeof(bunker->pixels[0])) != 0) {
+      runCount = 0;
+      int run = -1; // First output pixel of the current lit run
+      for (int ox = ox0; ox <= ox1; ox++) {
+        int px = ox < ox1 ? columns[ox - ox0] : -1;
+        bool lit = px >= 0 && ((row[px / BUNKER_WORD_BITS] >>
+                                (px % BUNKER_WORD_BITS)) & 1u);
+        if (lit && run < 0)
+          run = ox;
+        if (!lit && run >= 0) {
+          runStart[runCount] = (int16_t)run;
+          runEnd[runCount++] = (int16_t)ox;
+          run = -1;
+        }
+      }
+      lastRow = row;
+    }
+
+    for (int r = 0; r < runCount; r++)
+      fillRow(raster, pixels, oy, runStart[r], runEnd[r], pattern);
+  }
+}
+
+/** @brief Scales (if needed) and draws one entity. */
+static void drawSprite(Rasterizer *raster, uint8_t *pixels, SpriteId id,
+                       float x, float y, float w, float h) {
+  const ScaledSprite *sprite = getSprite(raster, id, w, h);
+  if (sprite)
+    drawScaled(raster, pixels, sprite, raster->patterns[id], x, y);
+}
+
+/** @brief Fills a logical rectangle (health bar). */
+static void drawRect(const Rasterizer *raster, uint8_t *pixels, int color,
+                     float x, float y, float w, float h) {
+  if (w <= 0.0f || h <= 0.0f)
+    return;
+
+  int px = toPixel(x, raster->scaleX);
+  int py = toPixel(y, raster->scaleY);
+  int width = toPixels(w, raster->scaleX);
+  int height = toPixels(h, raster->scaleY);
+  for (int row = py; row < py + height; row++)
+    fillRow(raster, pixels, row, px, px + width, raster->patterns[color]);
+}
+
+// ==========================================
+//               LIFECYCLE
+// ==========================================
+
+Rasterizer *createRasterizer(unsigned width, unsigned height,
+                             RasterFormat format, unsigned screenWidth,
+                             unsigned screenHeight) {
+  if (width == 0 || height == 0 || width > INT16_MAX ||
+      height > INT16_MAX || screenWidth == 0 || screenHeight == 0 ||
+      (format != RASTER_GRAY && format != RASTER_RGB))
+    return NULL;
+
+  Rasterizer *raster = (Rasterizer *)calloc(1, sizeof(Rasterizer));
+  if (!raster)
+    return NULL;
+
+  raster->width = (int)width;
+  raster->height = (int)height;
+  raster->format = format;
+  raster->scaleX = (float)width / (float)screenWidth;
+  raster->scaleY = (float)height / (float)screenHeight;
+
+  for (int c = 0; c < RASTER_COLOR_COUNT; c++) {
+    for (int i = 0; i < RASTER_PATTERN_SIZE; i++) {
+      raster->patterns[c][i] = (format == RASTER_GRAY)
+                                   ? rasterPalette[c][3]
+                                   : rasterPalette[c][i % 3];
+    }
+  }
+  return raster;
+}
+
+void destroyRasterizer(Rasterizer *raster) {
+  if (!raster)
+    return;
+  for (int i = 0; i < SPRITE_COUNT; i++)
+    free(raster->sprites[i].spans);
+  free(raster);
+}
+
+size_t getRasterFrameSize(const Rasterizer *raster) {
+  return (size_t)raster->width * raster->height * raster->format;
+}
+
+// ==========================================
+//               DRAWING
+// ==========================================
+
+/** @brief The grid of a SWARM_GRID level. */
+static void drawGrid(Rasterizer *raster, uint8_t *pixels, const Swarm *swarm) {
+  // Every enemy of the grid has the same size: scale the mask once
+  SpriteId alien = swarm->animationFrame ? SPRITE_ALIEN_2 : SPRITE_ALIEN_1;
+  const ScaledSprite *sprite =
+      getSprite(raster, alien, ENEMY_WIDTH, ENEMY_HEIGHT);
+  for (int i = 0; i < TOTAL_ENEMIES && sprite; i++) {
+    const Enemy *e = &swarm->enemies[i];
+    if (e->active) {
+      drawScaled(raster, pixels, sprite, raster->patterns[alien],
+                 fixedToFloat(getEnemyX(swarm, i)),
+                 fixedToFloat(getEnemyY(swarm, i)));
+    }
+  }
+}
+
+/** @brief The Boss of a SWARM_BOSS level and its health bar. */
+static void drawBoss(Rasterizer *raster, uint8_t *pixels, const Swarm *swarm) {
+  const Boss *boss = &swarm->boss;
+  if (!boss->active)
+    return;
+
+  float x = fixedToFloat(boss->x), y = fixedToFloat(boss->y);
+  float width = fixedToFloat(boss->width);
+  drawSprite(raster, pixels, SPRITE_BOSS, x, y, width,
+             fixedToFloat(boss->height));
+
+  float hpPercent = (float)boss->health / (float)boss->maxHealth;
+  float barY = y - RASTER_HEALTH_OFFSET;
+  drawRect(raster, pixels, RASTER_HEALTH_BACK, x, barY, width,
+           RASTER_HEALTH_HEIGHT);
+  drawRect(raster, pixels, RASTER_HEALTH_FRONT, x, barY, width * hpPercent,
+           RASTER_HEALTH_HEIGHT);
+}
+
+/** @brief How each SwarmKind is drawn. */
+static void (*const drawSwarmKinds[SWARM_KIND_COUNT])(Rasterizer *, uint8_t *,
+                                                      const Swarm *) = {
+    [SWARM_GRID] = drawGrid,
+    [SWARM_BOSS] = drawBoss,
+};
+
+void rasterize(Rasterizer *raster, uint8_t *pixels, const Player *player,
+               const Projectiles *projectiles, const Swarm *swarm,
+               const ExplosionManager *explosions,
+               const BunkerManager *bunkers) {
+  if (!raster || !pixels || !player)
+    return;
+
+  // Background
+  memset(pixels, 0, getRasterFrameSize(raster));
+
+  // A. Player
+  drawSprite(raster, pixels, SPRITE_PLAYER, fixedToFloat(player->x),
+             fixedToFloat(player->y), (float)player->width,
+             (float)player->height);
+
+  // B. Projectiles (Up = Player, Down = Enemy)
+  if (projectiles) {
+    for (unsigned i = 0; i < projectiles->count; i++) {
+      drawSprite(raster, pixels,
+                 projectiles->velocityY[i] < 0 ? SPRITE_BULLET_PLAYER
+                                               : SPRITE_BULLET_ENEMY,
+                 fixedToFloat(projectiles->x[i]),
+                 fixedToFloat(projectiles->y[i]), PROJECTILE_WIDTH,
+                 PROJECTILE_HEIGHT);
+    }
+  }
+
+  // C. Bunkers
+  if (bunkers) {
+    for (int b = 0; b < BUNKER_COUNT; b++) {
+      drawBunker(raster, pixels, &bunkers->bunkers[b],
+                 raster->patterns[SPRITE_BUNKER]);
+    }
+  }
+
+  // D. Enemies / Boss
+  if (swarm)
+    drawSwarmKinds[swarm->kind](raster, pixels, swarm);
+
+  // E. Explosions
+  if (explosions) {
+    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+      const Explosion *ex = &explosions->explosions[i];
+      if (ex->active && ex->currentFrame >= 0 && ex->currentFrame < 3) {
+        drawSprite(raster, pixels,
+                   (SpriteId)(SPRITE_EXPLOSION_1 + ex->currentFrame),
+                   fixedToFloat(ex->x), fixedToFloat(ex->y), EXPLOSION_SIZE,
+                   EXPLOSION_SIZE);
+      }
+    }
+  }
+}
+
+void rasterizeWorld(Rasterizer *raster, uint8_t *pixels, const World *world) {
+  if (!world)
+    return;
+  rasterize(raster, pixels, &world->player, &world->projectiles,
+            &world->swarm, &world->explosions, &world->bunkers);
+}
@@ -0,0 +1,32 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/rng.h"
+
+void seedRng(Rng *rng, uint64_t seed) {
+  if (!rng)
+    return;
+
+  // SplitMix64 finalizer: spreads the seed bits over the whole state
+  uint64_t z = seed + 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z ^= z >> 31;
+
+  // xorshift must never hold an all-zero state (it would stay stuck at 0)
+  rng->state = z ? z : 0x9E3779B97F4A7C15ULL;
+}
+
+uint64_t nextRng(Rng *rng) {
+  // xorshift64* (Marsaglia / Vigna)
+  uint64_t x = rng->state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  rng->state = x;
+  return x * 0x2545F4914F6CDD1DULL;
+}
+
+unsigned rngRange(Rng *rng, unsigned bound) {
+  // Take the (best quality) high 32 bits and scale them into [0, bound)
+  uint64_t high = nextRng(rng) >> 32;
+  return (unsigned)((high * bound) >> 32);
+}
@@ -0,0 +1,79 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/sim_clock.h"
+
+static double clampDouble(double v, double lo, double hi) {
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+void initSimClock(SimClock *clock, double hz, int maxSteps) {
+  if (!clock)
+    return;
+
+  hz = clampDouble(hz, SIM_MIN_HZ, SIM_MAX_HZ);
+  clock->stepSeconds = 1.0 / hz;
+  clock->accumulator = 0.0;
+  clock->timeScale = 1.0;
+  clock->maxSteps = maxSteps > 0 ? maxSteps : (int)(hz * SIM_CATCH_UP_SECONDS);
+  if (clock->maxSteps < 1)
+    clock->maxSteps = 1;
+  clock->turbo = false;
+  clock->steps = 0;
+  clock->droppedSeconds = 0.0;
+}
+
+int advanceSimClock(SimClock *clock, double realSeconds) {
+  if (!clock)
+    return 0;
+
+  // Turbo: as many steps as the budget allows, no leftover to draw
+  if (clock->turbo) {
+    clock->accumulator = 0.0;
+    clock->steps += clock->maxSteps;
+    return clock->maxSteps;
+  }
+
+  if (realSeconds > 0.0)
+    clock->accumulator += realSeconds * clock->timeScale;
+
+  // The epsilon absorbs the rounding of many small frame times adding up
+  // to a whole step
+  int steps = (int)(clock->accumulator / clock->stepSeconds + 1e-6);
+  if (steps > clock->maxSteps) {
+    // Over budget: keep the fraction of a step, drop the rest
+    double backlog = (steps - clock->maxSteps) * clock->stepSeconds;
+    clock->droppedSeconds += backlog;
+    clock->accumulator -= backlog;
+    steps = clock->maxSteps;
+  }
+  clock->accumulator -= steps * clock->stepSeconds;
+  if (clock->accumulator < 0.0) // Rounding of the subtractions
+    clock->accumulator = 0.0;
+
+  clock->steps += steps;
+  return steps;
+}
+
+void resetSimClock(SimClock *clock) {
+  if (clock)
+    clock->accumulator = 0.0;
+}
+
+float getSimStep(const SimClock *clock) { return (float)clock->stepSeconds; }
+
+float getSimAlpha(const SimClock *clock) {
+  float alpha = (float)(clock->accumulator / clock->stepSeconds);
+  return alpha < 1.0f ? alpha : 1.0f;
+}
+
+void setSimTimeScale(SimClock *clock, double scale) {
+  if (clock)
+    clock->timeScale =
+        clampDouble(scale, SIM_MIN_TIME_SCALE, SIM_MAX_TIME_SCALE);
+}
+
+void setSimTurbo(SimClock *clock, bool turbo) {
+  if (!clock)
+    return;
+  clock->turbo = turbo;
+  clock->accumulator = 0.0;
+}
@@ -0,0 +1,998 @@
+// Generated by tools/gen_sprite_masks.py from assets/*.png.
+// Do not edit by hand.
+
+#include "../../includes/sprite_masks.h"
+
+const uint8_t spriteMasks[SPRITE_COUNT][SPRITE_MASK_SIZE *
+                                        SPRITE_MASK_SIZE] = {
+    [SPRITE_PLAYER] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 56, 67, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 25, 213, 220, 46, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 5, 172, 255, 255, 190, 15, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 20, 255, 255, 255, 255, 60, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 82, 255, 255, 255, 255, 121, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 173, 255, 255, 255, 255, 202, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 173, 255, 255, 255, 255, 201, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            39, 228, 255, 255, 255, 255, 239, 55, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            61, 255, 255, 255, 255, 255, 255, 87, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            63, 255, 255, 255, 255, 255, 255, 88, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 202,
+            163, 255, 255, 255, 255, 255, 255, 176, 202, 13, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 191,
+            254, 255, 255, 255, 255, 255, 255, 254, 202, 29, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 254,
+            254, 255, 254, 255, 255, 255, 255, 254, 255, 173, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 254,
+            254, 254, 254, 255, 255, 255, 254, 254, 254, 173, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 181, 252,
+            254, 253, 254, 254, 255, 255, 254, 254, 254, 198, 16, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 255, 254,
+            254, 254, 254, 254, 255, 255, 254, 254, 254, 254, 64, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 40, 215, 254, 254,
+            254, 254, 254, 254, 255, 255, 254, 254, 254, 255, 227, 52,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 18, 178, 254, 255, 255, 254,
+            254, 253, 254, 254, 255, 254, 254, 254, 255, 254, 252, 255,
+            199, 33, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 5, 113, 212, 255, 254, 254, 254, 254,
+            254, 254, 254, 254, 255, 254, 254, 254, 254, 255, 254, 254,
+            254, 224, 126, 10, 0, 0, 0, 0,
+            0, 0, 1, 80, 199, 254, 255, 255, 255, 255, 255, 254,
+            255, 255, 254, 254, 255, 254, 254, 254, 254, 255, 254, 255,
+            254, 254, 254, 212, 80, 6, 0, 0,
+            0, 61, 169, 255, 255, 254, 255, 255, 255, 255, 255, 254,
+            255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255,
+            255, 255, 254, 252, 254, 184, 75, 0,
+            114, 242, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 254, 254, 253, 253, 254, 254, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 254, 254, 249, 132,
+            204, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,
+            254, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 254, 221,
+            176, 254, 254, 254, 255, 255, 255, 255, 255, 255, 254, 254,
+            254, 253, 254, 254, 254, 254, 254, 254, 255, 254, 255, 255,
+            254, 255, 254, 254, 254, 254, 254, 195,
+            14, 70, 166, 232, 253, 255, 255, 255, 255, 254, 255, 255,
+            255, 253, 255, 254, 254, 254, 254, 255, 255, 255, 255, 254,
+            254, 254, 255, 254, 234, 161, 86, 21,
+            0, 0, 0, 0, 41, 127, 199, 240, 255, 255, 255, 255,
+            255, 254, 254, 254, 254, 255, 254, 254, 255, 255, 254, 253,
+            241, 203, 141, 50, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 16, 101, 255, 255, 255,
+            255, 254, 254, 254, 254, 255, 255, 254, 255, 255, 254, 120,
+            20, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 43, 217, 255, 255, 255,
+            255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 233,
+            61, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 71, 248, 255, 255, 255, 255,
+            255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 254, 255,
+            251, 99, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 32, 254, 255, 255, 255, 255, 254,
+            187, 88, 142, 219, 227, 153, 81, 181, 249, 255, 255, 255,
+            255, 254, 61, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 28, 255, 255, 254, 253, 243, 162,
+            0, 0, 0, 33, 41, 0, 0, 0, 142, 234, 255, 255,
+            255, 255, 61, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 5, 112, 157, 111, 44, 39, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 49, 101,
+            157, 123, 10, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_ALIEN_1] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 115, 201, 201, 192, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            89, 208, 241, 255, 255, 254, 213, 144, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33,
+            242, 255, 255, 255, 255, 255, 255, 249, 57, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113,
+            255, 255, 255, 255, 255, 255, 255, 255, 206, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 246,
+            255, 255, 255, 255, 255, 255, 255, 255, 254, 106, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 1, 115, 178, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 128, 44,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 39, 81, 102, 254, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 176,
+            106, 63, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 73, 188, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,
+            255, 227, 97, 2, 0, 0, 0, 0,
+            0, 0, 0, 4, 64, 217, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 254, 93, 31, 0, 0, 0,
+            0, 0, 0, 60, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 157, 0, 0, 0,
+            0, 0, 50, 250, 254, 254, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 254, 251, 254, 252, 117, 0, 0,
+            0, 6, 198, 254, 233, 250, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 247, 238, 255, 252, 46, 0,
+            0, 65, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 246, 248, 255, 255, 170, 0,
+            0, 65, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 171, 0,
+            0, 38, 247, 254, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 251, 248, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 144, 0,
+            0, 0, 204, 254, 255, 255, 255, 254, 255, 255, 255, 255,
+            255, 255, 254, 224, 206, 252, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 244, 24, 0,
+            0, 0, 50, 253, 253, 254, 255, 255, 255, 255, 255, 255,
+            255, 255, 247, 216, 222, 226, 254, 254, 255, 255, 255, 255,
+            255, 255, 255, 254, 254, 122, 0, 0,
+            0, 0, 0, 175, 216, 252, 254, 255, 255, 255, 255, 255,
+            255, 255, 248, 209, 211, 227, 254, 255, 255, 255, 255, 255,
+            255, 255, 254, 221, 227, 3, 0, 0,
+            0, 0, 0, 14, 218, 252, 254, 254, 254, 254, 255, 255,
+            255, 255, 254, 233, 219, 253, 255, 255, 255, 255, 255, 254,
+            254, 253, 209, 229, 83, 0, 0, 0,
+            0, 0, 0, 0, 0, 186, 253, 241, 216, 252, 255, 255,
+            255, 255, 255, 254, 252, 255, 255, 255, 255, 255, 255, 231,
+            227, 254, 242, 29, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 136, 251, 249, 254, 255, 255,
+            235, 197, 194, 197, 197, 196, 196, 218, 255, 255, 255, 250,
+            248, 208, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 4, 8, 8, 154, 255, 255,
+            251, 244, 243, 243, 243, 243, 243, 247, 255, 255, 255, 29,
+            5, 3, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 25, 159,
+            255, 255, 255, 255, 255, 255, 255, 255, 224, 24, 23, 1,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+            252, 255, 255, 255, 255, 255, 255, 255, 92, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            56, 58, 57, 57, 57, 58, 57, 56, 12, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_ALIEN_2] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 95, 94, 94, 81, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            24, 51, 231, 255, 255, 230, 52, 15, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+            161, 255, 255, 255, 255, 255, 255, 148, 5, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 203,
+            255, 255, 255, 255, 255, 255, 255, 255, 90, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 242, 27, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 183, 255,
+            255, 254, 253, 255, 255, 255, 255, 255, 255, 136, 23, 13,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 1, 164, 250, 254, 255,
+            255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 194,
+            2, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 3, 241, 251, 253, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 251,
+            246, 42, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 174, 226, 228, 208, 243, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 208,
+            227, 227, 192, 0, 0, 0, 0, 0,
+            0, 0, 0, 93, 176, 239, 254, 250, 251, 254, 252, 255,
+            255, 255, 255, 255, 255, 253, 254, 254, 248, 246, 254, 249,
+            249, 254, 246, 187, 124, 0, 0, 0,
+            0, 0, 43, 214, 255, 252, 254, 255, 255, 252, 235, 243,
+            255, 255, 255, 255, 255, 255, 255, 248, 221, 230, 255, 255,
+            255, 254, 252, 255, 237, 63, 0, 0,
+            0, 0, 155, 255, 255, 255, 255, 255, 255, 254, 211, 208,
+            255, 255, 255, 255, 255, 255, 255, 242, 196, 225, 255, 255,
+            255, 255, 255, 255, 255, 189, 8, 0,
+            0, 40, 249, 255, 255, 255, 255, 255, 255, 255, 245, 242,
+            255, 255, 255, 255, 255, 255, 255, 252, 240, 248, 255, 255,
+            255, 255, 255, 255, 255, 255, 62, 0,
+            0, 166, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 210, 0,
+            0, 165, 228, 244, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 254, 209, 0,
+            0, 14, 178, 251, 255, 255, 233, 238, 255, 255, 255, 255,
+            255, 255, 255, 241, 242, 254, 255, 255, 255, 255, 255, 255,
+            245, 233, 255, 255, 255, 202, 27, 0,
+            0, 0, 25, 192, 255, 255, 237, 241, 255, 242, 235, 236,
+            228, 255, 255, 223, 216, 249, 255, 238, 249, 246, 249, 255,
+            247, 235, 255, 255, 213, 41, 0, 0,
+            0, 0, 0, 48, 241, 255, 255, 255, 255, 230, 217, 216,
+            209, 254, 254, 236, 219, 241, 255, 226, 236, 238, 242, 255,
+            255, 255, 255, 255, 79, 0, 0, 0,
+            0, 0, 0, 0, 111, 178, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 241, 232, 249, 255, 255, 255, 255, 255, 255,
+            255, 255, 206, 117, 4, 0, 0, 0,
+            0, 0, 0, 0, 0, 23, 94, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255,
+            255, 102, 42, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 4, 117, 119, 118, 192, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 119, 119,
+            116, 11, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 241,
+            255, 255, 255, 255, 255, 255, 255, 255, 252, 96, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 141,
+            255, 255, 255, 255, 255, 255, 255, 255, 128, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+            170, 197, 196, 197, 198, 197, 198, 148, 1, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_BOSS] =
+        {
+            0, 0, 0, 0, 0, 0, 66, 239, 134, 27, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 137,
+            239, 67, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 65, 255, 255, 247, 183, 111,
+            0, 0, 0, 32, 32, 0, 0, 0, 112, 184, 248, 255,
+            255, 66, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 66, 255, 255, 255, 255, 219,
+            9, 0, 0, 147, 148, 0, 0, 9, 220, 255, 255, 255,
+            255, 66, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 5, 208, 255, 255, 255, 255,
+            171, 251, 194, 192, 190, 195, 250, 171, 255, 255, 255, 255,
+            206, 5, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 48, 217, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217,
+            47, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 4, 96, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 97,
+            4, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 8, 156, 214, 199, 244, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            244, 199, 215, 159, 8, 0, 0, 0,
+            9, 69, 165, 233, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 232, 165, 68, 8,
+            181, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 176,
+            207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 228,
+            114, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 253, 119,
+            0, 65, 180, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 179, 52, 0,
+            0, 0, 2, 82, 222, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 221, 80, 0, 0, 0,
+            0, 0, 0, 0, 118, 251, 254, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 254, 251, 96, 0, 0, 0, 0,
+            0, 0, 0, 0, 7, 57, 24, 178, 254, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,
+            178, 23, 57, 8, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 250, 251, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 247,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 26, 119, 61, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 60, 120,
+            22, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 210, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 211, 57, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 142, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 150, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 142, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 206, 251,
+            255, 255, 255, 255, 255, 255, 255, 255, 251, 204, 5, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 78, 196,
+            226, 255, 255, 255, 255, 255, 255, 225, 190, 79, 9, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28,
+            118, 255, 255, 255, 255, 255, 255, 114, 27, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            198, 255, 255, 255, 255, 255, 255, 195, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+            221, 227, 255, 255, 255, 255, 225, 222, 35, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+            58, 177, 255, 255, 255, 255, 175, 59, 14, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 177, 255, 255, 255, 255, 176, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 124, 255, 255, 255, 255, 136, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 66, 255, 255, 255, 255, 52, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 1, 167, 255, 255, 169, 1, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 70, 80, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_BULLET_PLAYER] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 40, 153, 0, 30, 206, 209, 208, 205, 205,
+            205, 204, 200, 202, 203, 204, 206, 205, 207, 205, 191, 102,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 70, 230, 0, 51, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 169,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 85, 242, 5, 99, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 92, 204, 255, 212, 244, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250,
+            146, 119, 86, 0, 0, 0, 0, 0,
+            0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 194, 0, 0, 0, 0, 0,
+            0, 0, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 207, 0, 0, 0, 0, 0,
+            0, 0, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 244, 12, 0, 0, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 228, 66, 0, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 83, 0, 0, 0,
+            0, 0, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 120, 0, 0, 0,
+            0, 0, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 244, 183, 0, 0,
+            0, 0, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 246, 1, 0,
+            0, 0, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 237, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 250, 179, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 133, 0, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 89, 0, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 251, 96, 24, 0, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 212, 0, 0, 0, 0, 0,
+            0, 0, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 195, 0, 0, 0, 0, 0,
+            0, 0, 224, 255, 255, 220, 236, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251,
+            195, 189, 135, 0, 0, 0, 0, 0,
+            0, 0, 224, 255, 243, 11, 74, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 222, 255, 224, 0, 43, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 169,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 216, 255, 216, 0, 18, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 24, 63, 23, 0, 3, 67, 80, 81, 80, 80,
+            79, 78, 36, 23, 27, 29, 29, 28, 29, 26, 25, 13,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_BULLET_ENEMY] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 27, 32, 34, 37,
+            39, 40, 41, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 12, 255, 255, 255, 255,
+            255, 255, 255, 110, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 19, 255, 255, 255, 255,
+            255, 255, 255, 117, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 3, 4, 5, 6, 68, 255, 255, 255, 255,
+            255, 255, 255, 180, 32, 26, 8, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 146, 211, 212, 216, 240, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 145, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 197, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 159, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 8, 231, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 191, 8, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 31, 185, 246, 250, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 252, 220, 28, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 57, 255, 232, 243, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 45, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 58, 255, 233, 244, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 60, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 59, 255, 233, 244, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 142, 42, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 58, 255, 238, 248, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 58, 255, 246, 252, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 180, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 57, 255, 250, 254, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 180, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 57, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 179, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 179, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 234, 136, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 83, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 55, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 56, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 54, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 36, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 11, 90, 246, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 216, 68, 8, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 209, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 156, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 200, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 138, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 112, 159, 157, 159, 189, 255, 255, 255, 255,
+            255, 255, 255, 241, 167, 158, 80, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 42, 255, 255, 255, 255,
+            255, 255, 255, 147, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 34, 255, 255, 255, 255,
+            255, 255, 255, 115, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 17, 255, 255, 255, 255,
+            255, 255, 255, 110, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 2, 13, 13, 13, 13,
+            15, 15, 13, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_BUNKER] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 89, 105, 104, 105, 104, 105, 105, 105, 105,
+            104, 102, 103, 104, 104, 104, 105, 104, 105, 105, 105, 106,
+            105, 106, 106, 107, 97, 0, 0, 0,
+            0, 0, 0, 209, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 227, 0, 0, 0,
+            0, 0, 0, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 227, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 227, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 227, 0, 0, 0,
+            0, 0, 0, 209, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 227, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 227, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 209, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 225, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 225, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 225, 0, 0, 0,
+            0, 0, 0, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 225, 0, 0, 0,
+            0, 0, 0, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 225, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 226, 0, 0, 0,
+            0, 0, 0, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 225, 0, 0, 0,
+            0, 0, 0, 114, 142, 142, 142, 142, 141, 142, 143, 142,
+            142, 141, 142, 143, 142, 142, 142, 142, 142, 142, 142, 141,
+            141, 142, 142, 141, 123, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_EXPLOSION_1] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 14, 25, 79, 166, 61, 14, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            34, 190, 205, 243, 255, 219, 84, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            193, 255, 246, 228, 249, 204, 108, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            185, 241, 255, 255, 245, 253, 210, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27,
+            214, 238, 254, 255, 255, 255, 254, 71, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55,
+            209, 218, 253, 255, 233, 251, 191, 51, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            97, 246, 255, 238, 236, 245, 86, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            40, 220, 248, 181, 180, 252, 84, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 78, 137, 69, 17, 95, 4, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_EXPLOSION_2] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            75, 161, 161, 162, 14, 0, 0, 0, 0, 0, 0, 0,
+            0, 26, 145, 62, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+            250, 255, 255, 255, 196, 17, 0, 0, 0, 0, 0, 67,
+            86, 214, 255, 249, 51, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 140,
+            255, 255, 255, 255, 255, 239, 232, 177, 41, 2, 24, 253,
+            255, 255, 255, 232, 16, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 65, 255, 255, 255,
+            254, 245, 244, 250, 253, 255, 255, 255, 253, 255, 176, 255,
+            255, 255, 246, 48, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 56, 232, 255, 255, 255,
+            254, 240, 246, 251, 250, 254, 255, 255, 255, 255, 255, 255,
+            255, 255, 253, 74, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 42, 223, 255, 250, 254, 255,
+            250, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 93, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 107, 255, 249, 243, 254, 255,
+            255, 255, 255, 202, 162, 175, 255, 255, 255, 255, 255, 255,
+            255, 255, 157, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 1, 187, 255, 245, 254, 255, 254,
+            234, 242, 113, 28, 0, 12, 239, 243, 251, 255, 255, 255,
+            255, 255, 160, 56, 0, 0, 0, 0,
+            0, 0, 0, 0, 13, 162, 255, 255, 252, 255, 255, 155,
+            0, 0, 0, 0, 0, 0, 0, 0, 149, 255, 255, 255,
+            255, 255, 255, 140, 0, 0, 0, 0,
+            0, 0, 0, 0, 156, 255, 255, 248, 253, 255, 83, 13,
+            0, 0, 0, 0, 0, 0, 0, 0, 12, 124, 252, 255,
+            255, 255, 255, 255, 2, 0, 0, 0,
+            0, 0, 0, 0, 215, 255, 248, 236, 252, 255, 5, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 255,
+            255, 255, 255, 255, 3, 0, 0, 0,
+            0, 0, 0, 0, 217, 255, 233, 249, 255, 133, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 255,
+            255, 255, 255, 255, 5, 0, 0, 0,
+            0, 0, 0, 86, 254, 255, 249, 251, 255, 99, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 255,
+            255, 255, 255, 255, 183, 16, 0, 0,
+            0, 0, 0, 197, 255, 255, 255, 255, 212, 21, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 237,
+            255, 255, 255, 255, 255, 56, 0, 0,
+            0, 0, 0, 246, 255, 255, 255, 255, 255, 96, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155,
+            255, 255, 255, 255, 255, 55, 0, 0,
+            0, 0, 0, 212, 255, 255, 255, 255, 255, 105, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 231,
+            255, 255, 255, 255, 125, 4, 0, 0,
+            0, 0, 0, 47, 243, 255, 255, 255, 255, 110, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 255,
+            254, 246, 255, 255, 2, 0, 0, 0,
+            0, 0, 0, 0, 56, 255, 255, 252, 255, 230, 11, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 203, 254,
+            244, 243, 255, 255, 2, 0, 0, 0,
+            0, 0, 0, 0, 43, 255, 255, 255, 255, 255, 154, 59,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 235, 254,
+            246, 254, 255, 162, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 170, 254, 255, 255, 255, 255, 163,
+            0, 0, 0, 0, 0, 0, 0, 7, 45, 217, 255, 254,
+            255, 255, 162, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 54, 254, 255, 255, 255, 255, 245,
+            149, 2, 0, 0, 0, 5, 143, 168, 255, 255, 254, 246,
+            255, 255, 56, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 3, 160, 255, 255, 255, 255, 254, 255,
+            255, 234, 229, 229, 83, 175, 255, 255, 255, 254, 241, 247,
+            255, 224, 32, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 14, 245, 255, 255, 255, 255, 252, 255,
+            255, 255, 255, 255, 255, 255, 250, 254, 255, 252, 250, 255,
+            255, 140, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 155, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 250, 247, 245, 252, 255, 255, 255, 255,
+            255, 3, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 18, 224, 225, 247, 255, 234, 252, 255,
+            255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 216,
+            110, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 8, 194, 93, 89, 116, 44, 102, 203,
+            255, 255, 255, 255, 255, 255, 255, 213, 117, 176, 255, 65,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 9,
+            16, 159, 232, 255, 255, 204, 188, 23, 0, 6, 17, 4,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 155, 255, 255, 41, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+    [SPRITE_EXPLOSION_3] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 87, 0,
+            79, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 150, 0,
+            193, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            140, 20, 111, 118, 39, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 111, 254, 255, 213, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            21, 183, 73, 105, 128, 0, 0, 0, 0, 0, 0, 39,
+            93, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            149, 191, 37, 7, 0, 42, 32, 201, 22, 0, 0, 111,
+            244, 94, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+            25, 107, 0, 0, 0, 0, 7, 160, 118, 0, 0, 224,
+            255, 116, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 8, 162, 231, 181, 64, 184,
+            8, 0, 0, 9, 23, 0, 0, 24, 0, 0, 113, 253,
+            201, 23, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 144, 251, 131, 60, 61, 30,
+            0, 0, 0, 9, 24, 0, 0, 112, 0, 17, 204, 219,
+            30, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 31, 230, 135, 0, 0, 0, 119,
+            16, 0, 0, 0, 0, 0, 0, 53, 0, 23, 173, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 62, 183, 2, 0, 0, 20,
+            3, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 22,
+            82, 17, 10, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 16, 110, 36, 16, 81, 100,
+            16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            11, 188, 225, 8, 0, 0, 0, 0,
+            0, 0, 0, 0, 6, 0, 0, 5, 0, 3, 17, 6,
+            1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 15, 192, 141, 0, 0, 0, 0,
+            0, 0, 0, 0, 37, 0, 81, 63, 38, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 32, 0,
+            0, 0, 71, 179, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 95, 222, 38, 1, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 53, 0,
+            0, 0, 39, 84, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 245, 69, 0, 52, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 43, 0, 0, 0, 0, 0,
+            0, 0, 0, 80, 223, 241, 0, 0, 128, 7, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 26,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 206, 237, 67, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38,
+            0, 0, 0, 54, 0, 0, 0, 0,
+            0, 0, 0, 207, 252, 133, 58, 16, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17,
+            59, 18, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 57, 169, 246, 252, 158, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+            190, 151, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 2, 65, 135, 217, 0, 0, 0, 109,
+            13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 44, 0, 34, 222, 76, 0, 0, 18,
+            1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 1,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 144, 162, 48, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 30, 6, 0, 110,
+            0, 44, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 146, 254, 172, 1, 0,
+            0, 0, 4, 10, 0, 0, 0, 9, 171, 12, 0, 8,
+            32, 168, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 139, 255, 253, 48, 0,
+            0, 0, 78, 122, 97, 0, 22, 99, 35, 22, 67, 35,
+            217, 80, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 138, 255, 172, 0, 21,
+            2, 88, 4, 6, 127, 0, 66, 9, 0, 0, 4, 186,
+            146, 4, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 48, 155, 67, 72, 179,
+            128, 230, 0, 37, 247, 69, 0, 0, 0, 0, 0, 63,
+            8, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 63, 9, 7, 173,
+            186, 181, 10, 163, 171, 146, 9, 0, 0, 31, 11, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            7, 15, 0, 27, 0, 0, 0, 0, 0, 50, 17, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 18, 5, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 18, 5, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+        },
+};
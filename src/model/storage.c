@@ -9,6 +9,7 @@
  */
 
 #define _POSIX_C_SOURCE 200809L
+#include "../../includes/sim_float.h"
 #include "../../includes/storage.h"
 #include "../../includes/json_helper.h"
 #include <limits.h>
@@ -0,0 +1,233 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/timer_wheel.h"
+#include <stdlib.h>
+
+#define SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+
+/** @brief Ticks covered by the whole wheel: farther deadlines are clamped. */
+#define WHEEL_SPAN                                                             \
+  ((uint64_t)1 << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS))
+
+_Static_assert(TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS < TIMER_WHEEL_IDLE,
+               "slot numbers must fit TimerWheel.slot");
+
+static inline uint64_t toTick(TimerTime t) {
+  return t >> TIMER_WHEEL_TICK_BITS;
+}
+
+/** @brief Ticks covered by one slot of `level` (64^level). */
+static inline uint64_t getSlotTicks(int level) {
+  return (uint64_t)1 << (TIMER_WHEEL_SLOT_BITS * level);
+}
+
+// ==========================================
+//               ALLOCATION
+// ==========================================
+
+TimerWheel *createTimerWheel(uint32_t capacity) {
+  if (capacity == 0 || capacity == TIMER_NONE)
+    return NULL;
+
+  TimerWheel *w = (TimerWheel *)calloc(1, sizeof(TimerWheel));
+  if (!w)
+    return NULL;
+
+  w->capacity = capacity;
+  w->deadline = (TimerTime *)calloc(capacity, sizeof(TimerTime));
+  w->next = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+  w->prev = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+  w->slot = (uint16_t *)malloc(capacity * sizeof(uint16_t));
+  if (!w->deadline || !w->next || !w->prev || !w->slot) {
+    destroyTimerWheel(w);
+    return NULL;
+  }
+
+  for (int s = 0; s < TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS; s++)
+    w->heads[s] = TIMER_NONE;
+  for (uint32_t id = 0; id < capacity; id++) {
+    w->next[id] = w->prev[id] = TIMER_NONE;
+    w->slot[id] = TIMER_WHEEL_IDLE;
+  }
+  return w;
+}
+
+void destroyTimerWheel(TimerWheel *wheel) {
+  if (!wheel)
+    return;
+
+  free(wheel->deadline);
+  free(wheel->next);
+  free(wheel->prev);
+  free(wheel->slot);
+  free(wheel);
+}
+
+// ==========================================
+//               SLOT LISTS
+// ==========================================
+
+static void linkTimer(TimerWheel *w, uint32_t id, int slot) {
+  uint32_t head = w->heads[slot];
+  w->next[id] = head;
+  w->prev[id] = TIMER_NONE;
+  if (head != TIMER_NONE)
+    w->prev[head] = id;
+  w->heads[slot] = id;
+  w->slot[id] = (uint16_t)slot;
+  w->occupied[slot / TIMER_WHEEL_SLOTS] |= 1ull << (slot & SLOT_MASK);
+}
+
+static void unlinkTimer(TimerWheel *w, uint32_t id) {
+  int slot = w->slot[id];
+  uint32_t next = w->next[id], prev = w->prev[id];
+  if (prev != TIMER_NONE)
+    w->next[prev] = next;
+  else
+    w->heads[slot] = next;
+  if (next != TIMER_NONE)
+    w->prev[next] = prev;
+
+  if (w->heads[slot] == TIMER_NONE)
+    w->occupied[slot / TIMER_WHEEL_SLOTS] &= ~(1ull << (slot & SLOT_MASK));
+  w->slot[id] = TIMER_WHEEL_IDLE;
+}
+
+/**
+ * @brief Puts a timer in the finest level whose range holds its deadline,
+ * counted from the wheel's current tick. Overdue timers go to the current
+ * slot (they fire at the next advance); deadlines beyond the wheel wait in
+ * the last level and are placed again when it cascades.
+ */
+static void placeTimer(TimerWheel *w, uint32_t id) {
+  uint64_t current = toTick(w->now);
+  uint64_t tick = toTick(w->deadline[id]);
+  if (tick < current)
+    tick = current;
+  if (tick - current >= WHEEL_SPAN)
+    tick = current + WHEEL_SPAN - 1;
+
+  uint64_t delta = tick - current;
+  int level = 0;
+  while (level < TIMER_WHEEL_LEVELS - 1 && delta >= getSlotTicks(level + 1))
+    level++;
+
+  int slot = (int)(tick >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK;
+  linkTimer(w, id, level * TIMER_WHEEL_SLOTS + slot);
+}
+
+// ==========================================
+//               SCHEDULING
+// ==========================================
+
+void scheduleTimer(TimerWheel *wheel, uint32_t id, TimerTime deadline) {
+  if (!wheel || id >= wheel->capacity)
+    return;
+
+  if (wheel->slot[id] != TIMER_WHEEL_IDLE)
+    unlinkTimer(wheel, id);
+  else
+    wheel->pending++;
+  wheel->deadline[id] = deadline;
+  placeTimer(wheel, id);
+}
+
+void cancelTimer(TimerWheel *wheel, uint32_t id) {
+  if (!wheel || id >= wheel->capacity || wheel->slot[id] == TIMER_WHEEL_IDLE)
+    return;
+
+  unlinkTimer(wheel, id);
+  wheel->pending--;
+}
+
+bool isTimerPending(const TimerWheel *wheel, uint32_t id) {
+  return wheel && id < wheel->capacity && wheel->slot[id] != TIMER_WHEEL_IDLE;
+}
+
+// ==========================================
+//               ADVANCE
+// ==========================================
+
+/** @brief Fires the timers of level-0 slot `slot` that are due at `now`. */
+static uint32_t expireSlot(TimerWheel *w, int slot, TimerTime now,
+                           uint32_t *fired, uint32_t count) {
+  uint32_t id = w->heads[slot];
+  while (id != TIMER_NONE) {
+    uint32_t next = w->next[id];
+    if (w->deadline[id] <= now) {
+      unlinkTimer(w, id);
+      w->pending--;
+      fired[count++] = id;
+    }
+    id = next;
+  }
+  return count;
+}
+
+/** @brief Empties a slot of an upper level into the finer levels. */
+static void cascadeSlot(TimerWheel *w, int level, int slot) {
+  int s = level * TIMER_WHEEL_SLOTS + slot;
+  uint32_t id = w->heads[s];
+  w->heads[s] = TIMER_NONE;
+  w->occupied[level] &= ~(1ull << slot);
+
+  while (id != TIMER_NONE) {
+    uint32_t next = w->next[id];
+    placeTimer(w, id);
+    id = next;
+  }
+}
+
+/**
+ * @brief Enters tick `tick`: when it starts a new turn of one or more
+ * levels, their slot for it moves down (coarsest first, so that a timer can
+ * fall through several levels at once).
+ */
+static void enterTick(TimerWheel *w, uint64_t tick) {
+  w->now = tick << TIMER_WHEEL_TICK_BITS;
+
+  int levels = 0;
+  while (levels < TIMER_WHEEL_LEVELS - 1 &&
+         (tick & (getSlotTicks(levels + 1) - 1)) == 0)
+    levels++;
+
+  for (int level = levels; level >= 1; level--) {
+    int slot = (int)(tick >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK;
+    if (w->occupied[level] & (1ull << slot))
+      cascadeSlot(w, level, slot);
+  }
+}
+
+uint32_t advanceTimerWheel(TimerWheel *wheel, TimerTime now, uint32_t *fired) {
+  if (!wheel || !fired)
+    return 0;
+  if (now < wheel->now)
+    now = wheel->now;
+
+  uint64_t tick = toTick(wheel->now);
+  uint64_t last = toTick(now);
+  uint32_t count = 0;
+  for (;;) {
+    count = expireSlot(wheel, (int)(tick & SLOT_MASK), now, fired, count);
+    if (tick == last)
+      break;
+
+    // Next tick worth a visit: an occupied level-0 slot before the end of
+    // this turn, else the start of the next turn (cascades), at most `last`
+    uint64_t turnEnd = (tick | SLOT_MASK) + 1;
+    int position = (int)(tick & SLOT_MASK);
+    uint64_t ahead = position == SLOT_MASK
+                         ? 0
+                         : wheel->occupied[0] & (~0ull << (position + 1));
+    uint64_t turnStart = tick & ~(uint64_t)SLOT_MASK;
+    uint64_t next = ahead ? turnStart + __builtin_ctzll(ahead) : turnEnd;
+    tick = next < last ? next : last;
+
+    if (tick == turnEnd)
+      enterTick(wheel, tick);
+    else
+      wheel->now = tick << TIMER_WHEEL_TICK_BITS;
+  }
+
+  wheel->now = now;
+  return count;
+}
@@ -0,0 +1,184 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/world.h"
+#include "../../includes/physics.h"
+#include <stdlib.h>
+#include <string.h>
+
+World *createWorld(unsigned screenWidth, unsigned screenHeight, int level,
+                   uint64_t seed) {
+  World *w = (World *)calloc(1, sizeof(World));
+  if (!w)
+    return NULL;
+
+  initWorld(w, screenWidth, screenHeight, level, seed);
+  return w;
+}
+
+void initWorld(World *world, unsigned screenWidth, unsigned screenHeight,
+               int level, uint64_t seed) {
+  if (!world)
+    return;
+
+  world->screenWidth = screenWidth;
+  world->screenHeight = screenHeight;
+  world->startLevel = level;
+  world->clock = 0;
+
+  initPlayer(&world->player, FIXED(screenWidth) / 2, WORLD_PLAYER_HEIGHT,
+             WORLD_PLAYER_WIDTH);
+  initExplosionManager(&world->explosions);
+  resetBunkers(&world->bunkers, screenWidth);
+  initSwarm(&world->swarm, level, world->clock);
+
+  resetWorld(world);
+  seedWorld(world, seed);
+}
+
+void seedWorld(World *world, uint64_t seed) {
+  if (world)
+    seedSwarm(&world->swarm, seed);
+}
+
+void destroyWorld(World *world) {
+  if (world)
+    free(world);
+}
+
+/**
+ * @brief Reinitializes the swarm and the bullet pool for `level`.
+ * Same "hard reset" the runners used to perform between levels.
+ */
+static void loadLevel(World *world, int level) {
+  // Keep the random stream going across swarms
+  Rng rng = world->swarm.rng;
+  initSwarm(&world->swarm, level, world->clock);
+  world->swarm.rng = rng;
+
+  initProjectiles(&world->projectiles, world->projectiles.capacity);
+  world->currentLevel = level;
+}
+
+void resetWorld(World *world) {
+  if (!world)
+    return;
+
+  Player *p = &world->player;
+  p->x = FIXED(world->screenWidth) / 2;
+  p->y = FIXED((int)world->screenHeight - 50);
+  p->velocityX = 0;
+  p->shootReadyAt = world->clock;
+  p->health = HEALTH;
+  p->score = 0;
+  // Note: highScore persists across games.
+
+  initExplosionManager(&world->explosions);
+  resetBunkers(&world->bunkers, world->screenWidth);
+
+  world->state = STATE_PLAYING;
+  world->playerWon = false;
+  loadLevel(world, world->startLevel);
+}
+
+unsigned updateWorld(World *world, float deltaTime) {
+  if (!world || world->state != STATE_PLAYING)
+    return WORLD_EVENT_NONE;
+
+  unsigned events = WORLD_EVENT_NONE;
+  world->clock += secondsToTimer(deltaTime);
+  TimerTime now = world->clock;
+  Fixed dt = fixedFromFloat(deltaTime);
+
+  updatePlayer(&world->player, dt, now, world->screenWidth);
+  updateProjectiles(&world->projectiles, dt, world->screenHeight);
+  updateSwarm(&world->swarm, dt, now, world->screenWidth);
+  updateExplosions(&world->explosions, now);
+
+  if (enemyAttemptShoot(&world->swarm, &world->projectiles, now))
+    events |= WORLD_EVENT_ENEMY_SHOOT;
+
+  bool hit = false;
+  if (checkCollisions(&world->player, &world->swarm, &world->projectiles,
+                      &world->explosions, &world->bunkers, &hit, now)) {
+    world->state = STATE_GAME_OVER;
+    world->playerWon = false;
+    events |= WORLD_EVENT_PLAYER_DIED;
+  }
+  if (hit)
+    events |= WORLD_EVENT_ENEMY_HIT;
+
+  // Level Progression
+  if (isSwarmDestroyed(&world->swarm)) {
+    if (world->currentLevel + 1 > LEVEL_COUNT) {
+      world->state = STATE_GAME_OVER;
+      world->playerWon = true;
+      events |= WORLD_EVENT_GAME_WON;
+    } else {
+      loadLevel(world, world->currentLevel + 1);
+      events |= WORLD_EVENT_LEVEL_CHANGE;
+    }
+  }
+  return events;
+}
+
+unsigned stepWorld(World *world, WorldAction action, float deltaTime) {
+  if (!world || world->state != STATE_PLAYING)
+    return WORLD_EVENT_NONE;
+
+  // What the controllers would do
+  setPlayerDirection(&world->player, action.move);
+  if (action.fire)
+    playerShoot(&world->player, &world->projectiles, world->clock);
+
+  return updateWorld(world, deltaTime);
+}
+
+static inline Fixed lerp(Fixed from, Fixed to, Fixed alpha) {
+  return from + fixedMul(to - from, alpha);
+}
+
+void interpolateWorld(World *out, const World *previous, const World *current,
+                      float alpha) {
+  if (!out || !current)
+    return;
+
+  memcpy(out, current, sizeof(World));
+  if (!previous || previous->state != current->state ||
+      previous->currentLevel != current->currentLevel)
+    return;
+
+  Fixed a = fixedFromFloat(alpha);
+  out->player.x = lerp(previous->player.x, current->player.x, a);
+  if (previous->swarm.boss.active && current->swarm.boss.active)
+    out->swarm.boss.x = lerp(previous->swarm.boss.x, current->swarm.boss.x, a);
+
+  // Bullets carry their position before the last step (swept collision)
+  Projectiles *p = &out->projectiles;
+  for (unsigned i = 0; i < p->count; i++) {
+    p->x[i] = lerp(p->prevX[i], p->x[i], a);
+    p->y[i] = lerp(p->prevY[i], p->y[i], a);
+  }
+}
+
+void worldSnapshot(const World *world, WorldSnapshot *snapshot) {
+  if (!world || !snapshot)
+    return;
+
+  snapshot->magic = WORLD_SNAPSHOT_MAGIC;
+  snapshot->version = WORLD_SNAPSHOT_VERSION;
+  snapshot->size = (uint32_t)sizeof(World);
+  snapshot->reserved = 0;
+  memcpy(&snapshot->world, world, sizeof(World));
+}
+
+bool worldRestore(World *world, const WorldSnapshot *snapshot) {
+  if (!world || !snapshot)
+    return false;
+
+  if (snapshot->magic != WORLD_SNAPSHOT_MAGIC ||
+      snapshot->version != WORLD_SNAPSHOT_VERSION ||
+      snapshot->size != sizeof(World))
+    return false;
+
+  memcpy(world, &snapshot->world, sizeof(World));
+  return true;
+}
@@ -0,0 +1,851 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/world_batch.h"
+#include "../../includes/physics.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================
+//               ALLOCATION
+// ==========================================
+
+/** @brief Arrays with one entry per game. */
+#define BATCH_GAME_ARRAYS(X)                                                   \
+  X(currentLevel)                                                              \
+  X(state)                                                                     \
+  X(playerWon)                                                                 \
+  X(clock)                                                                     \
+  X(playerX)                                                                   \
+  X(playerY)                                                                   \
+  X(playerVelocityX)                                                           \
+  X(playerShootReadyAt)                                                        \
+  X(playerAnimAt)                                                              \
+  X(playerAnimFrame)                                                           \
+  X(playerAnimDir)                                                             \
+  X(playerWidth)                                                               \
+  X(playerHeight)                                                              \
+  X(playerHealth)                                                              \
+  X(playerScore)                                                               \
+  X(playerHighScore)                                                           \
+  X(bulletCount)                                                               \
+  X(bulletCapacity)                                                            \
+  X(swarmLevel)                                                                \
+  X(swarmKind)                                                                 \
+  X(swarmDirection)                                                            \
+  X(swarmLastMoveAt)                                                           \
+  X(swarmMoveInterval)                                                         \
+  X(swarmShootAt)                                                              \
+  X(swarmShootCooldown)                                                        \
+  X(swarmAliveCount)                                                           \
+  X(swarmAlive)                                                                \
+  X(swarmOriginX)                                                              \
+  X(swarmOriginY)                                                              \
+  X(swarmAnimationFrame)                                                       \
+  X(swarmRng)                                                                  \
+  X(bossActive)                                                                \
+  X(bossX)                                                                     \
+  X(bossY)                                                                     \
+  X(bossWidth)                                                                 \
+  X(bossHeight)                                                                \
+  X(bossHealth)                                                                \
+  X(bossMaxHealth)                                                             \
+  X(bossDirection)                                                             \
+  X(explosions)                                                                \
+  X(bunkers)
+
+/** @brief Arrays with MAX_PROJECTILES entries per game. */
+#define BATCH_BULLET_ARRAYS(X)                                                 \
+  X(bulletX)                                                                   \
+  X(bulletY)                                                                   \
+  X(bulletVelocityX)                                                           \
+  X(bulletVelocityY)                                                           \
+  X(bulletPrevX)                                                               \
+  X(bulletPrevY)
+
+/** @brief Arrays with TOTAL_ENEMIES entries per game. */
+#define BATCH_ENEMY_ARRAYS(X)                                                  \
+  X(enemyActive)
+
+/**
+ * @brief The timers of one game on the batch's wheel: timer `kind` of game
+ * `i` has id `i * BATCH_TIMERS + kind`.
+ */
+typedef enum {
+  BATCH_TIMER_PLAYER_ANIM, /**< Next exhaust frame (playerAnimAt). */
+  BATCH_TIMER_SWARM_MOVE,  /**< Next swarm step (SWARM_GRID only). */
+  BATCH_TIMER_SWARM_SHOOT, /**< Next enemy shot (swarmShootAt). */
+  BATCH_TIMER_EXPLOSION,   /**< Next frame of explosion slot 0, 1, ... */
+  BATCH_TIMERS = BATCH_TIMER_EXPLOSION + MAX_EXPLOSIONS
+} BatchTimer;
+
+/** @brief Cache line size: every array starts on its own line. */
+#define BATCH_ALIGNMENT 64
+
+/**
+ * @brief Allocates a zeroed, cache-line aligned array.
+ * Clears `*ok` on failure so that all allocations can be checked at once.
+ */
+static void *allocArray(size_t count, size_t elementSize, bool *ok) {
+  size_t bytes = count * elementSize;
+  bytes = (bytes + BATCH_ALIGNMENT - 1) / BATCH_ALIGNMENT * BATCH_ALIGNMENT;
+
+  void *array = aligned_alloc(BATCH_ALIGNMENT, bytes);
+  if (!array) {
+    *ok = false;
+    return NULL;
+  }
+  memset(array, 0, bytes);
+  return array;
+}
+
+WorldBatch *createWorldBatch(int count, unsigned screenWidth,
+                             unsigned screenHeight, int level, uint64_t seed) {
+  if (count <= 0)
+    return NULL;
+
+  WorldBatch *b = (WorldBatch *)calloc(1, sizeof(WorldBatch));
+  if (!b)
+    return NULL;
+
+  b->count = count;
+  b->screenWidth = screenWidth;
+  b->screenHeight = screenHeight;
+  b->startLevel = level;
+
+  bool ok = true;
+  size_t n = (size_t)count;
+#define ALLOC_GAME(f) b->f = allocArray(n, sizeof(*b->f), &ok);
+#define ALLOC_BULLET(f)                                                        \
+  b->f = allocArray(n * MAX_PROJECTILES, sizeof(*b->f), &ok);
+#define ALLOC_ENEMY(f) b->f = allocArray(n * TOTAL_ENEMIES, sizeof(*b->f), &ok);
+  BATCH_GAME_ARRAYS(ALLOC_GAME)
+  BATCH_BULLET_ARRAYS(ALLOC_BULLET)
+  BATCH_ENEMY_ARRAYS(ALLOC_ENEMY)
+#undef ALLOC_GAME
+#undef ALLOC_BULLET
+#undef ALLOC_ENEMY
+  b->timers = createTimerWheel((uint32_t)(n * BATCH_TIMERS));
+  b->firedTimers = allocArray(n * BATCH_TIMERS, sizeof(uint32_t), &ok);
+  b->playing = allocArray(n, sizeof(bool), &ok);
+  b->stepEvents = allocArray(n, sizeof(unsigned), &ok);
+
+  if (!b->timers || !ok) {
+    destroyWorldBatch(b);
+    return NULL;
+  }
+
+  // Every game starts exactly like a World created with the same seed
+  World *w = (World *)malloc(sizeof(World));
+  if (!w) {
+    destroyWorldBatch(b);
+    return NULL;
+  }
+  for (int i = 0; i < count; i++) {
+    initWorld(w, screenWidth, screenHeight, level, seed + (uint64_t)i);
+    loadBatchWorld(b, i, w);
+  }
+  free(w);
+  return b;
+}
+
+void destroyWorldBatch(WorldBatch *batch) {
+  if (!batch)
+    return;
+
+#define FREE_ARRAY(f) free(batch->f);
+  BATCH_GAME_ARRAYS(FREE_ARRAY)
+  BATCH_BULLET_ARRAYS(FREE_ARRAY)
+  BATCH_ENEMY_ARRAYS(FREE_ARRAY)
+#undef FREE_ARRAY
+  destroyTimerWheel(batch->timers);
+  free(batch->firedTimers);
+  free(batch->playing);
+  free(batch->stepEvents);
+  free(batch);
+}
+
+// ==========================================
+//               TIMERS
+// ==========================================
+
+static inline uint32_t getTimerId(int i, int kind) {
+  return (uint32_t)i * BATCH_TIMERS + (uint32_t)kind;
+}
+
+/**
+ * @brief Schedules timer `kind` of game `i` at `deadline`, a time of the
+ * game's clock. A deadline already reached fires at the next step, as
+ * World's compares would.
+ */
+static void scheduleGameTimer(WorldBatch *b, int i, int kind,
+                              TimerTime deadline) {
+  TimerTime now = b->timers->now;
+  TimerTime clock = b->clock[i];
+  TimerTime at = deadline > clock ? now + (deadline - clock) : now;
+  scheduleTimer(b->timers, getTimerId(i, kind), at);
+}
+
+/** @brief Next step of the swarm of game `i` (SWARM_GRID), next shot. */
+static void scheduleSwarmTimers(WorldBatch *b, int i) {
+  if (b->swarmKind[i] == SWARM_GRID)
+    scheduleGameTimer(b, i, BATCH_TIMER_SWARM_MOVE,
+                      b->swarmLastMoveAt[i] + b->swarmMoveInterval[i]);
+  else
+    cancelTimer(b->timers, getTimerId(i, BATCH_TIMER_SWARM_MOVE));
+  scheduleGameTimer(b, i, BATCH_TIMER_SWARM_SHOOT, b->swarmShootAt[i]);
+}
+
+/**
+ * @brief Puts every deadline of game `i` on the wheel if it is playing,
+ * or takes them all off if it is not.
+ */
+static void syncGameTimers(WorldBatch *b, int i) {
+  if (b->state[i] != STATE_PLAYING) {
+    for (int kind = 0; kind < BATCH_TIMERS; kind++)
+      cancelTimer(b->timers, getTimerId(i, kind));
+    return;
+  }
+
+  scheduleGameTimer(b, i, BATCH_TIMER_PLAYER_ANIM, b->playerAnimAt[i]);
+  scheduleSwarmTimers(b, i);
+  for (int k = 0; k < MAX_EXPLOSIONS; k++) {
+    const Explosion *e = &b->explosions[i].explosions[k];
+    if (e->active)
+      scheduleGameTimer(b, i, BATCH_TIMER_EXPLOSION + k, e->nextFrameAt);
+    else
+      cancelTimer(b->timers, getTimerId(i, BATCH_TIMER_EXPLOSION + k));
+  }
+}
+
+// ==========================================
+//            SCATTER / GATHER
+// ==========================================
+
+/**
+ * @brief Copies a Swarm (grid + scalars + boss) into slot `i`.
+ */
+static void loadSwarm(WorldBatch *b, int i, const Swarm *s) {
+  bool *ea = b->enemyActive + (size_t)i * TOTAL_ENEMIES;
+  for (int j = 0; j < TOTAL_ENEMIES; j++)
+    ea[j] = s->enemies[j].active;
+
+  b->swarmLevel[i] = s->level;
+  b->swarmKind[i] = s->kind;
+  b->swarmDirection[i] = s->direction;
+  b->swarmLastMoveAt[i] = s->lastMoveAt;
+  b->swarmMoveInterval[i] = s->moveInterval;
+  b->swarmShootAt[i] = s->shootAt;
+  b->swarmShootCooldown[i] = s->shootCooldown;
+  b->swarmAliveCount[i] = s->aliveCount;
+  b->swarmAlive[i] = s->alive;
+  b->swarmOriginX[i] = s->originX;
+  b->swarmOriginY[i] = s->originY;
+  b->swarmAnimationFrame[i] = s->animationFrame;
+  b->swarmRng[i] = s->rng;
+
+  b->bossActive[i] = s->boss.active;
+  b->bossX[i] = s->boss.x;
+  b->bossY[i] = s->boss.y;
+  b->bossWidth[i] = s->boss.width;
+  b->bossHeight[i] = s->boss.height;
+  b->bossHealth[i] = s->boss.health;
+  b->bossMaxHealth[i] = s->boss.maxHealth;
+  b->bossDirection[i] = s->boss.direction;
+}
+
+void loadBatchWorld(WorldBatch *b, int i, const World *w) {
+  if (!b || !w || i < 0 || i >= b->count)
+    return;
+
+  b->currentLevel[i] = w->currentLevel;
+  b->state[i] = w->state;
+  b->playerWon[i] = w->playerWon;
+  b->clock[i] = w->clock;
+
+  const Player *p = &w->player;
+  b->playerX[i] = p->x;
+  b->playerY[i] = p->y;
+  b->playerVelocityX[i] = p->velocityX;
+  b->playerShootReadyAt[i] = p->shootReadyAt;
+  b->playerAnimAt[i] = p->animAt;
+  b->playerAnimFrame[i] = p->animFrame;
+  b->playerAnimDir[i] = p->animDir;
+  b->playerWidth[i] = p->width;
+  b->playerHeight[i] = p->height;
+  b->playerHealth[i] = p->health;
+  b->playerScore[i] = p->score;
+  b->playerHighScore[i] = p->highScore;
+
+  // The pool is already in SoA form: one copy per array
+  const Projectiles *pr = &w->projectiles;
+  size_t base = (size_t)i * MAX_PROJECTILES;
+  size_t bytes = pr->count * sizeof(Fixed);
+  b->bulletCount[i] = pr->count;
+  b->bulletCapacity[i] = pr->capacity;
+  memcpy(b->bulletX + base, pr->x, bytes);
+  memcpy(b->bulletY + base, pr->y, bytes);
+  memcpy(b->bulletVelocityX + base, pr->velocityX, bytes);
+  memcpy(b->bulletVelocityY + base, pr->velocityY, bytes);
+  memcpy(b->bulletPrevX + base, pr->prevX, bytes);
+  memcpy(b->bulletPrevY + base, pr->prevY, bytes);
+
+  loadSwarm(b, i, &w->swarm);
+  b->explosions[i] = w->explosions;
+  b->bunkers[i] = w->bunkers;
+  syncGameTimers(b, i);
+}
+
+void storeBatchWorld(const WorldBatch *b, int i, World *w) {
+  if (!b || !w || i < 0 || i >= b->count)
+    return;
+
+  memset(w, 0, sizeof(World));
+  w->screenWidth = b->screenWidth;
+  w->screenHeight = b->screenHeight;
+  w->startLevel = b->startLevel;
+  w->currentLevel = b->currentLevel[i];
+  w->state = b->state[i];
+  w->playerWon = b->playerWon[i];
+  w->clock = b->clock[i];
+
+  Player *p = &w->player;
+  p->x = b->playerX[i];
+  p->y = b->playerY[i];
+  p->velocityX = b->playerVelocityX[i];
+  p->shootReadyAt = b->playerShootReadyAt[i];
+  p->animAt = b->playerAnimAt[i];
+  p->animFrame = b->playerAnimFrame[i];
+  p->animDir = b->playerAnimDir[i];
+  p->width = b->playerWidth[i];
+  p->height = b->playerHeight[i];
+  p->health = b->playerHealth[i];
+  p->score = b->playerScore[i];
+  p->highScore = b->playerHighScore[i];
+
+  Projectiles *pr = &w->projectiles;
+  size_t base = (size_t)i * MAX_PROJECTILES;
+  size_t bytes = b->bulletCount[i] * sizeof(Fixed);
+  pr->count = b->bulletCount[i];
+  pr->capacity = b->bulletCapacity[i];
+  memcpy(pr->x, b->bulletX + base, bytes);
+  memcpy(pr->y, b->bulletY + base, bytes);
+  memcpy(pr->velocityX, b->bulletVelocityX + base, bytes);
+  memcpy(pr->velocityY, b->bulletVelocityY + base, bytes);
+  memcpy(pr->prevX, b->bulletPrevX + base, bytes);
+  memcpy(pr->prevY, b->bulletPrevY + base, bytes);
+
+  Swarm *s = &w->swarm;
+  bool grid = (b->swarmKind[i] == SWARM_GRID); // Only it has a real grid
+  size_t ebase = (size_t)i * TOTAL_ENEMIES;
+  for (int j = 0; j < TOTAL_ENEMIES; j++) {
+    s->enemies[j].active = b->enemyActive[ebase + j];
+    s->enemies[j].width = grid ? ENEMY_WIDTH : 0;
+    s->enemies[j].height = grid ? ENEMY_HEIGHT : 0;
+    s->enemies[j].killScore = grid ? ENEMY_KILL_SCORE : 0;
+  }
+  s->enemyHash = hashSwarmEnemies(s); // The batch keeps no copy of it
+  s->level = b->swarmLevel[i];
+  s->kind = b->swarmKind[i];
+  s->direction = b->swarmDirection[i];
+  s->lastMoveAt = b->swarmLastMoveAt[i];
+  s->moveInterval = b->swarmMoveInterval[i];
+  s->shootAt = b->swarmShootAt[i];
+  s->shootCooldown = b->swarmShootCooldown[i];
+  s->aliveCount = b->swarmAliveCount[i];
+  s->alive = b->swarmAlive[i];
+  s->originX = b->swarmOriginX[i];
+  s->originY = b->swarmOriginY[i];
+  s->animationFrame = b->swarmAnimationFrame[i];
+  s->rng = b->swarmRng[i];
+
+  s->boss.active = b->bossActive[i];
+  s->boss.x = b->bossX[i];
+  s->boss.y = b->bossY[i];
+  s->boss.width = b->bossWidth[i];
+  s->boss.height = b->bossHeight[i];
+  s->boss.health = b->bossHealth[i];
+  s->boss.maxHealth = b->bossMaxHealth[i];
+  s->boss.direction = b->bossDirection[i];
+
+  w->explosions = b->explosions[i];
+  w->bunkers = b->bunkers[i];
+}
+
+/**
+ * @brief Same as the World's loadLevel(): fresh swarm (random stream kept)
+ * and an empty bullet pool.
+ */
+static void loadBatchLevel(WorldBatch *b, int i, int level) {
+  Swarm s;
+  initSwarm(&s, level, b->clock[i]);
+  s.rng = b->swarmRng[i];
+  loadSwarm(b, i, &s);
+  if (b->state[i] == STATE_PLAYING)
+    scheduleSwarmTimers(b, i);
+
+  // initProjectiles(): empty pool, capacity kept (0 = not set yet)
+  unsigned capacity = b->bulletCapacity[i];
+  if (capacity == 0 || capacity > MAX_PROJECTILES)
+    capacity = MAX_PROJECTILES;
+  b->bulletCapacity[i] = capacity;
+  b->bulletCount[i] = 0;
+  b->currentLevel[i] = level;
+}
+
+void resetBatchWorld(WorldBatch *b, int i) {
+  if (!b || i < 0 || i >= b->count)
+    return;
+
+  b->playerX[i] = FIXED(b->screenWidth) / 2;
+  b->playerY[i] = FIXED((int)b->screenHeight - 50);
+  b->playerVelocityX[i] = 0;
+  b->playerShootReadyAt[i] = b->clock[i];
+  b->playerHealth[i] = HEALTH;
+  b->playerScore[i] = 0;
+
+  initExplosionManager(&b->explosions[i]);
+  resetBunkers(&b->bunkers[i], b->screenWidth);
+
+  b->state[i] = STATE_PLAYING;
+  b->playerWon[i] = false;
+  loadBatchLevel(b, i, b->startLevel);
+  syncGameTimers(b, i);
+}
+
+// ==========================================
+//               STEP PHASES
+// ==========================================
+
+/**
+ * @brief spawnProjectile() on the bullet slice of game `i`.
+ */
+static void spawnBatchBullet(WorldBatch *b, int i, Fixed x, Fixed y,
+                             DirectionProjectile direction) {
+  unsigned k = b->bulletCount[i];
+  if (k >= b->bulletCapacity[i])
+    return; // Pool full: the shot is dropped
+
+  size_t s = (size_t)i * MAX_PROJECTILES + k;
+  b->bulletX[s] = x;
+  b->bulletY[s] = y;
+  b->bulletPrevX[s] = x;
+  b->bulletPrevY[s] = y;
+  getProjectileVelocity(direction, &b->bulletVelocityX[s],
+                        &b->bulletVelocityY[s]);
+  b->bulletCount[i] = k + 1;
+}
+
+/** @brief killProjectile() on the bullet slice of game `i`. */
+static void killBatchBullet(WorldBatch *b, int i, unsigned k) {
+  size_t base = (size_t)i * MAX_PROJECTILES;
+  size_t s = base + k;
+  size_t last = base + --b->bulletCount[i];
+  b->bulletX[s] = b->bulletX[last];
+  b->bulletY[s] = b->bulletY[last];
+  b->bulletVelocityX[s] = b->bulletVelocityX[last];
+  b->bulletVelocityY[s] = b->bulletVelocityY[last];
+  b->bulletPrevX[s] = b->bulletPrevX[last];
+  b->bulletPrevY[s] = b->bulletPrevY[last];
+}
+
+/** @brief setPlayerDirection() + playerShoot() for every game. */
+static void applyActions(WorldBatch *b, const WorldAction *actions,
+                         const bool *playing) {
+  for (int i = 0; i < b->count; i++) {
+    if (!playing[i])
+      continue;
+
+    Direction move = actions[i].move;
+    b->playerVelocityX[i] = (move == MOVE_NONE)   ? 0
+                            : (move == MOVE_LEFT) ? -PLAYER_SPEED
+                                                  : PLAYER_SPEED;
+
+    if (actions[i].fire && b->clock[i] >= b->playerShootReadyAt[i]) {
+      Fixed bulletX = b->playerX[i] + FIXED(b->playerWidth[i]) / 2 -
+                      FIXED(PROJECTILE_WIDTH) / 2;
+      spawnBatchBullet(b, i, bulletX, b->playerY[i], MOVE_UP);
+      b->playerShootReadyAt[i] =
+          b->clock[i] + secondsToTimer(PLAYER_SHOOT_COOLDOWN);
+    }
+  }
+}
+
+/**
+ * @brief updatePlayer() for every game, as one branch-free loop, without
+ * the animation (a timer). Also moves the clocks forward by `ticks`.
+ */
+static void updatePlayers(WorldBatch *b, const bool *playing, Fixed dt,
+                          TimerTime ticks) {
+  Fixed *restrict px = b->playerX;
+  const Fixed *restrict vx = b->playerVelocityX;
+  TimerTime *restrict clock = b->clock;
+  const unsigned *restrict width = b->playerWidth;
+  unsigned screenWidth = b->screenWidth;
+
+  // Movement and clock (vectorizable)
+  for (int i = 0; i < b->count; i++) {
+    Fixed x = px[i] + fixedMul(vx[i], dt);
+    x = (x < 0) ? 0 : x;
+    Fixed maxX = FIXED((int)screenWidth - (int)width[i]);
+    x = (x > maxX) ? maxX : x;
+
+    px[i] = playing[i] ? x : px[i];
+    clock[i] += playing[i] ? ticks : 0;
+  }
+}
+
+/** @brief updateProjectiles() for every game. */
+static void updateBullets(WorldBatch *b, const bool *playing, Fixed dt) {
+  Fixed height = FIXED(b->screenHeight);
+
+  for (int i = 0; i < b->count; i++) {
+    if (!playing[i])
+      continue;
+
+    // Same two passes as updateProjectiles(): drop the bullets that left
+    // the screen last step (swap-remove), then move the live slots
+    size_t base = (size_t)i * MAX_PROJECTILES;
+    for (unsigned k = 0; k < b->bulletCount[i];) {
+      Fixed bx = b->bulletX[base + k], by = b->bulletY[base + k];
+      if (by < 0 || by > height || bx < 0 || bx > FIXED(800))
+        killBatchBullet(b, i, k);
+      else
+        k++;
+    }
+
+    Fixed *restrict x = b->bulletX + base;
+    Fixed *restrict y = b->bulletY + base;
+    const Fixed *restrict vx = b->bulletVelocityX + base;
+    const Fixed *restrict vy = b->bulletVelocityY + base;
+    Fixed *restrict prevX = b->bulletPrevX + base;
+    Fixed *restrict prevY = b->bulletPrevY + base;
+    unsigned count = b->bulletCount[i];
+    for (unsigned k = 0; k < count; k++) {
+      prevX[k] = x[k];
+      prevY[k] = y[k];
+      x[k] += fixedMul(vx[k], dt);
+      y[k] += fixedMul(vy[k], dt);
+    }
+  }
+}
+
+/** @brief The Boss half of updateSwarm() (continuous) for every game. */
+static void updateBosses(WorldBatch *b, const bool *playing, Fixed dt) {
+  for (int i = 0; i < b->count; i++) {
+    if (!playing[i] || b->swarmKind[i] != SWARM_BOSS || !b->bossActive[i])
+      continue;
+
+    b->bossX[i] += b->bossDirection[i] * fixedMul(BOSS_SPEED, dt);
+
+    Fixed screenWidth = FIXED(b->screenWidth);
+    if (b->bossX[i] <= 0) {
+      b->bossX[i] = 0;
+      b->bossDirection[i] = 1;
+    } else if (b->bossX[i] + b->bossWidth[i] >= screenWidth) {
+      b->bossX[i] = screenWidth - b->bossWidth[i];
+      b->bossDirection[i] = -1;
+    }
+  }
+}
+
+/** @brief The exhaust animation of updatePlayer(), when its time comes. */
+static void animatePlayer(WorldBatch *b, int i) {
+  b->playerAnimAt[i] = b->clock[i] + secondsToTimer(PLAYER_ANIM_PERIOD);
+  scheduleGameTimer(b, i, BATCH_TIMER_PLAYER_ANIM, b->playerAnimAt[i]);
+
+  b->playerAnimFrame[i] += b->playerAnimDir[i];
+  if (b->playerAnimFrame[i] >= 3) {
+    b->playerAnimFrame[i] = 3;
+    b->playerAnimDir[i] = -1;
+  } else if (b->playerAnimFrame[i] <= 0) {
+    b->playerAnimFrame[i] = 0;
+    b->playerAnimDir[i] = 1;
+  }
+}
+
+/** @brief One step of the swarm of updateSwarm(), when its time comes. */
+static void stepSwarm(WorldBatch *b, int i) {
+  b->swarmLastMoveAt[i] = b->clock[i];
+  scheduleSwarmTimers(b, i);
+  b->swarmAnimationFrame[i] = !b->swarmAnimationFrame[i];
+
+  Fixed originX = b->swarmOriginX[i];
+  Fixed leftEdgeX = originX;
+  Fixed rightEdgeX =
+      originX + FIXED((ENEMY_COLS - 1) * ENEMY_PITCH_X + ENEMY_WIDTH);
+  getSwarmEdges(&b->swarmAlive[i], originX, &leftEdgeX, &rightEdgeX);
+  int direction = b->swarmDirection[i];
+  bool hitEdge = (direction == 1 && rightEdgeX >= FIXED(b->screenWidth)) ||
+                 (direction == -1 && leftEdgeX <= 0);
+
+  if (hitEdge) {
+    b->swarmDirection[i] = -direction;
+    b->swarmOriginY[i] += ENEMY_DROP_AMOUNT;
+  } else {
+    b->swarmOriginX[i] += ENEMY_STEP_X * direction;
+  }
+}
+
+/** @brief enemyAttemptShoot() for game `i`, when its time comes. */
+static void shootEnemies(WorldBatch *b, int i, unsigned *events) {
+  b->swarmShootAt[i] = b->clock[i] + b->swarmShootCooldown[i];
+  scheduleGameTimer(b, i, BATCH_TIMER_SWARM_SHOOT, b->swarmShootAt[i]);
+
+  if (b->swarmKind[i] == SWARM_BOSS) {
+    if (!b->bossActive[i])
+      return;
+    Fixed bulletX =
+        b->bossX[i] + b->bossWidth[i] / 2 - FIXED(PROJECTILE_WIDTH) / 2;
+    Fixed bulletY = b->bossY[i] + b->bossHeight[i];
+    spawnBatchBullet(b, i, bulletX, bulletY, MOVE_DOWN);
+    spawnBatchBullet(b, i, bulletX, bulletY, MOVE_DOWN_LEFT);
+    spawnBatchBullet(b, i, bulletX, bulletY, MOVE_DOWN_RIGHT);
+    events[i] |= WORLD_EVENT_ENEMY_SHOOT;
+    return;
+  }
+
+  int startCol = (int)rngRange(&b->swarmRng[i], ENEMY_COLS);
+  int shooter = pickSwarmShooter(&b->swarmAlive[i], startCol);
+  if (shooter >= 0) {
+    Fixed enemyX = b->swarmOriginX[i] +
+                   FIXED((shooter % ENEMY_COLS) * ENEMY_PITCH_X);
+    Fixed enemyY = b->swarmOriginY[i] +
+                   FIXED((shooter / ENEMY_COLS) * ENEMY_PITCH_Y);
+    Fixed bulletX =
+        enemyX + FIXED(ENEMY_WIDTH) / 2 - FIXED(PROJECTILE_WIDTH) / 2;
+    Fixed bulletY = enemyY + FIXED(ENEMY_HEIGHT);
+    spawnBatchBullet(b, i, bulletX, bulletY, MOVE_DOWN);
+    events[i] |= WORLD_EVENT_ENEMY_SHOOT;
+  }
+}
+
+/**
+ * @brief Runs the timers that fired this step, in the phase order of
+ * updateWorld(): the animations, swarm steps and explosion frames first,
+ * then the shots (which start from the swarm's new position).
+ */
+static void runTimers(WorldBatch *b, uint32_t fired, unsigned *events) {
+  const uint32_t *ids = b->firedTimers;
+  for (uint32_t t = 0; t < fired; t++) {
+    int i = (int)(ids[t] / BATCH_TIMERS);
+    int kind = (int)(ids[t] % BATCH_TIMERS);
+    if (kind == BATCH_TIMER_PLAYER_ANIM) {
+      animatePlayer(b, i);
+    } else if (kind == BATCH_TIMER_SWARM_MOVE) {
+      stepSwarm(b, i);
+    } else if (kind >= BATCH_TIMER_EXPLOSION) {
+      Explosion *e = &b->explosions[i].explosions[kind - BATCH_TIMER_EXPLOSION];
+      if (advanceExplosion(e, b->clock[i]))
+        scheduleGameTimer(b, i, kind, e->nextFrameAt);
+    }
+  }
+
+  for (uint32_t t = 0; t < fired; t++) {
+    if (ids[t] % BATCH_TIMERS == BATCH_TIMER_SWARM_SHOOT)
+      shootEnemies(b, (int)(ids[t] / BATCH_TIMERS), events);
+  }
+}
+
+/**
+ * @brief updateSwarmSpeed() for game `i`, after a kill: the next step and
+ * shot come sooner.
+ */
+static void updateBatchSwarmSpeed(WorldBatch *b, int i) {
+  unsigned count = countSwarmAlive(&b->swarmAlive[i]);
+  b->swarmAliveCount[i] = count;
+
+  b->swarmMoveInterval[i] =
+      getSwarmInterval(MIN_MOVE_INTERVAL, MAX_MOVE_INTERVAL, count);
+  b->swarmShootCooldown[i] =
+      getSwarmInterval(MIN_SHOOT_COOLDOWN, MAX_SHOOT_COOLDOWN, count);
+  scheduleSwarmTimers(b, i);
+}
+
+/** @brief spawnExplosion() for game `i`, with its first frame scheduled. */
+static void spawnBatchExplosion(WorldBatch *b, int i, Fixed x, Fixed y) {
+  int k = spawnExplosion(&b->explosions[i], x, y, b->clock[i]);
+  if (k >= 0)
+    scheduleGameTimer(b, i, BATCH_TIMER_EXPLOSION + k,
+                      b->explosions[i].explosions[k].nextFrameAt);
+}
+
+/** @brief findImpact() for bullet slot `s` of the batch. */
+static Impact findBulletImpact(const WorldBatch *b,
+                               const ImpactTargets *targets, size_t s) {
+  return findImpact(targets, b->bulletPrevX[s], b->bulletPrevY[s],
+                    b->bulletX[s], b->bulletY[s], FIXED(PROJECTILE_WIDTH),
+                    FIXED(PROJECTILE_HEIGHT), b->bulletVelocityY[s]);
+}
+
+/**
+ * @brief checkCollisions() for game `i`: same impacts, same time order.
+ * @return true if the player lost its last life.
+ */
+static bool collideGame(WorldBatch *b, int i, unsigned *events) {
+  size_t base = (size_t)i * MAX_PROJECTILES;
+  ImpactTargets targets = {&b->bunkers[i],
+                           &b->swarmAlive[i],
+                           b->swarmOriginX[i],
+                           b->swarmOriginY[i],
+                           b->swarmAnimationFrame[i],
+                           b->swarmKind[i] == SWARM_BOSS && b->bossActive[i],
+                           b->bossX[i],
+                           b->bossY[i],
+                           b->bossWidth[i],
+                           b->bossHeight[i],
+                           b->playerX[i],
+                           b->playerY[i],
+                           FIXED(b->playerWidth[i]),
+                           FIXED(b->playerHeight[i])};
+
+  Impact impacts[MAX_PROJECTILES];
+  int count = (int)b->bulletCount[i];
+  int pending = findImpacts(&targets, b->bulletPrevX + base,
+                            b->bulletPrevY + base, b->bulletX + base,
+                            b->bulletY + base, b->bulletVelocityY + base,
+                            count, impacts);
+
+  bool hit[MAX_PROJECTILES] = {false};
+  bool changed = false;
+  bool playerDied = false;
+  while (pending > 0 && !playerDied) {
+    int next = nextImpact(impacts, pending);
+    Impact impact = impacts[next];
+    size_t s = base + impact.slot;
+    if (changed) {
+      impact = findBulletImpact(b, &targets, s);
+      impact.slot = impacts[next].slot;
+      if (!isSameImpact(&impact, &impacts[next])) {
+        impacts[next] = impact;
+        if (impact.kind == IMPACT_NONE)
+          impacts[next] = impacts[--pending];
+        continue;
+      }
+    }
+    impacts[next] = impacts[--pending];
+    hit[impact.slot] = true;
+    changed = true;
+
+    switch (impact.kind) {
+    case IMPACT_BUNKER:
+      blastBunkerCrater(&b->bunkers[i].bunkers[impact.target], impact.x,
+                        impact.y);
+      break;
+
+    case IMPACT_BOSS:
+      b->bossHealth[i]--;
+      if (b->bossHealth[i] <= 0) {
+        b->bossActive[i] = false;
+        targets.bossActive = false;
+        b->playerScore[i] += 1000;
+        spawnBatchExplosion(b, i, b->bossX[i], b->bossY[i]);
+        events[i] |= WORLD_EVENT_ENEMY_HIT;
+      }
+      break;
+
+    case IMPACT_ENEMY: {
+      int j = impact.target;
+      b->enemyActive[(size_t)i * TOTAL_ENEMIES + j] = false;
+      clearSwarmAlive(&b->swarmAlive[i], j);
+      updateBatchSwarmSpeed(b, i);
+      b->playerScore[i] += ENEMY_KILL_SCORE;
+      Fixed enemyX =
+          b->swarmOriginX[i] + FIXED((j % ENEMY_COLS) * ENEMY_PITCH_X);
+      Fixed enemyY =
+          b->swarmOriginY[i] + FIXED((j / ENEMY_COLS) * ENEMY_PITCH_Y);
+      spawnBatchExplosion(b, i, enemyX, enemyY);
+      events[i] |= WORLD_EVENT_ENEMY_HIT;
+      break;
+    }
+
+    case IMPACT_PLAYER:
+      if (b->playerHealth[i] > 0) {
+        b->playerHealth[i]--;
+        if (b->playerHealth[i] == 0)
+          playerDied = true;
+      }
+      break;
+
+    case IMPACT_NONE:
+      break;
+    }
+  }
+
+  for (int k = count - 1; k >= 0; k--) {
+    if (hit[k])
+      killBatchBullet(b, i, (unsigned)k);
+  }
+  return playerDied;
+}
+
+// The batch stores the swarm as grid and Boss columns, and its step phases
+// only know these two kinds: a new SwarmKind needs its columns here first.
+_Static_assert(SWARM_KIND_COUNT == 2, "the batch only stores grid and Boss");
+
+/** @brief isGridDestroyed() for game `i`. */
+static bool isBatchGridDestroyed(const WorldBatch *b, int i) {
+  return b->swarmAliveCount[i] == 0;
+}
+
+/** @brief isBossDestroyed() for game `i`. */
+static bool isBatchBossDestroyed(const WorldBatch *b, int i) {
+  return !b->bossActive[i];
+}
+
+/** @brief When the level of a game is cleared, per SwarmKind. */
+static bool (*const isBatchSwarmDestroyed[SWARM_KIND_COUNT])(
+    const WorldBatch *, int) = {
+    [SWARM_GRID] = isBatchGridDestroyed,
+    [SWARM_BOSS] = isBatchBossDestroyed,
+};
+
+void stepWorldBatch(WorldBatch *batch, const WorldAction *actions,
+                    float deltaTime, unsigned *events) {
+  if (!batch || !actions)
+    return;
+
+  int n = batch->count;
+  bool *playing = batch->playing;
+  unsigned *ev = events ? events : batch->stepEvents;
+
+  for (int i = 0; i < n; i++) {
+    playing[i] = (batch->state[i] == STATE_PLAYING);
+    ev[i] = WORLD_EVENT_NONE;
+  }
+
+  // Same phase order as updateWorld(), each phase across the whole batch;
+  // the timed ones only visit the games whose timers fired
+  applyActions(batch, actions, playing);
+  TimerTime ticks = secondsToTimer(deltaTime);
+  Fixed dt = fixedFromFloat(deltaTime);
+  updatePlayers(batch, playing, dt, ticks);
+  uint32_t fired = advanceTimerWheel(batch->timers, batch->timers->now + ticks,
+                                     batch->firedTimers);
+  updateBullets(batch, playing, dt);
+  updateBosses(batch, playing, dt);
+  runTimers(batch, fired, ev);
+
+  for (int i = 0; i < n; i++) {
+    if (!playing[i])
+      continue;
+
+    if (collideGame(batch, i, ev)) {
+      batch->state[i] = STATE_GAME_OVER;
+      batch->playerWon[i] = false;
+      ev[i] |= WORLD_EVENT_PLAYER_DIED;
+      syncGameTimers(batch, i);
+    }
+
+    // Level Progression (isSwarmDestroyed)
+    if (isBatchSwarmDestroyed[batch->swarmKind[i]](batch, i)) {
+      if (batch->currentLevel[i] + 1 > LEVEL_COUNT) {
+        batch->state[i] = STATE_GAME_OVER;
+        batch->playerWon[i] = true;
+        ev[i] |= WORLD_EVENT_GAME_WON;
+        syncGameTimers(batch, i);
+      } else {
+        loadBatchLevel(batch, i, batch->currentLevel[i] + 1);
+        ev[i] |= WORLD_EVENT_LEVEL_CHANGE;
+      }
+    }
+  }
+}
@@ -0,0 +1,226 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/world_fork.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================
+//               LAYOUT
+// ==========================================
+
+/**
+ * @brief Where each shareable block lives inside a World.
+ * Declared in ascending offset order (enemies, explosions, bunkers), which
+ * lets the hot-state packing walk the World from start to end.
+ */
+static const struct {
+  ForkBlockId id;
+  size_t offset;
+  size_t size;
+} blockLayout[FORK_BLOCK_COUNT] = {
+    {FORK_BLOCK_ENEMIES, offsetof(World, swarm) + offsetof(Swarm, enemies),
+     sizeof(((Swarm *)0)->enemies)},
+    {FORK_BLOCK_EXPLOSIONS, offsetof(World, explosions),
+     sizeof(ExplosionManager)},
+    {FORK_BLOCK_BUNKERS, offsetof(World, bunkers), sizeof(BunkerManager)},
+};
+
+_Static_assert(offsetof(World, swarm) < offsetof(World, explosions) &&
+                   offsetof(World, explosions) < offsetof(World, bunkers),
+               "blockLayout must stay sorted by offset");
+
+/** @brief Bytes of a World that are not part of any shareable block. */
+#define WORLD_FORK_HOT_SIZE                                                    \
+  (sizeof(World) - sizeof(((Swarm *)0)->enemies) - sizeof(ExplosionManager) - \
+   sizeof(BunkerManager))
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/**
+ * @brief A reference-counted chunk of World memory.
+ */
+typedef struct {
+  unsigned refs;        /**< Number of forks pointing at this block. */
+  size_t size;          /**< Payload size in bytes. */
+  unsigned char data[]; /**< Raw copy of the World region. */
+} ForkBlock;
+
+struct WorldFork {
+  ForkBlock *blocks[FORK_BLOCK_COUNT];    /**< Indexed by ForkBlockId. */
+  unsigned char hot[WORLD_FORK_HOT_SIZE]; /**< Packed non-block bytes. */
+};
+
+// ==========================================
+//            HELPER FUNCTIONS
+// ==========================================
+
+static ForkBlock *createBlock(const void *data, size_t size) {
+  ForkBlock *b = (ForkBlock *)malloc(sizeof(ForkBlock) + size);
+  if (!b)
+    return NULL;
+
+  b->refs = 1;
+  b->size = size;
+  memcpy(b->data, data, size);
+  return b;
+}
+
+static void releaseBlock(ForkBlock *b) {
+  if (b && --b->refs == 0)
+    free(b);
+}
+
+/**
+ * @brief Copies the hot bytes between a World and the packed `hot` buffer.
+ * @param world   The full World.
+ * @param hot     The packed buffer (WORLD_FORK_HOT_SIZE bytes).
+ * @param toWorld true: hot -> world, false: world -> hot.
+ */
+static void transferHot(unsigned char *world, unsigned char *hot,
+                        bool toWorld) {
+  size_t cursor = 0; // Position in the World
+  size_t packed = 0; // Position in the hot buffer
+
+  for (int i = 0; i <= FORK_BLOCK_COUNT; i++) {
+    // The gap before the next block (or up to the end of the World)
+    size_t end = (i < FORK_BLOCK_COUNT) ? blockLayout[i].offset : sizeof(World);
+    size_t gap = end - cursor;
+
+    if (toWorld)
+      memcpy(world + cursor, hot + packed, gap);
+    else
+      memcpy(hot + packed, world + cursor, gap);
+    packed += gap;
+
+    if (i < FORK_BLOCK_COUNT)
+      cursor = end + blockLayout[i].size;
+  }
+}
+
+// ==========================================
+//           PUBLIC FUNCTIONS
+// ==========================================
+
+WorldFork *createWorldFork(const World *world) {
+  if (!world)
+    return NULL;
+
+  WorldFork *fork = (WorldFork *)calloc(1, sizeof(WorldFork));
+  if (!fork)
+    return NULL;
+
+  const unsigned char *raw = (const unsigned char *)world;
+  for (int i = 0; i < FORK_BLOCK_COUNT; i++) {
+    fork->blocks[blockLayout[i].id] =
+        createBlock(raw + blockLayout[i].offset, blockLayout[i].size);
+    if (!fork->blocks[blockLayout[i].id]) {
+      destroyWorldFork(fork);
+      return NULL;
+    }
+  }
+
+  transferHot((unsigned char *)world, fork->hot, false);
+  return fork;
+}
+
+WorldFork *forkWorld(const WorldFork *parent) {
+  if (!parent)
+    return NULL;
+
+  WorldFork *child = (WorldFork *)malloc(sizeof(WorldFork));
+  if (!child)
+    return NULL;
+
+  // Hot state is copied, blocks are only referenced
+  memcpy(child, parent, sizeof(WorldFork));
+  for (int i = 0; i < FORK_BLOCK_COUNT; i++)
+    child->blocks[i]->refs++;
+
+  return child;
+}
+
+void destroyWorldFork(WorldFork *fork) {
+  if (!fork)
+    return;
+
+  for (int i = 0; i < FORK_BLOCK_COUNT; i++)
+    releaseBlock(fork->blocks[i]);
+  free(fork);
+}
+
+void materializeWorldFork(const WorldFork *fork, World *out) {
+  if (!fork || !out)
+    return;
+
+  unsigned char *raw = (unsigned char *)out;
+  for (int i = 0; i < FORK_BLOCK_COUNT; i++) {
+    const ForkBlock *b = fork->blocks[blockLayout[i].id];
+    memcpy(raw + blockLayout[i].offset, b->data, b->size);
+  }
+  transferHot(raw, (unsigned char *)fork->hot, true);
+}
+
+unsigned stepWorldFork(WorldFork *fork, WorldAction action, float deltaTime) {
+  if (!fork)
+    return WORLD_EVENT_NONE;
+
+  // 1. Step a scratch copy of the full World
+  World scratch;
+  materializeWorldFork(fork, &scratch);
+  unsigned events = stepWorld(&scratch, action, deltaTime);
+
+  // 2. Find the blocks that were written, allocate copies for shared ones
+  // first, so that an allocation failure leaves the fork untouched.
+  const unsigned char *raw = (const unsigned char *)&scratch;
+  bool changed[FORK_BLOCK_COUNT];
+  ForkBlock *copies[FORK_BLOCK_COUNT] = {NULL};
+
+  for (int i = 0; i < FORK_BLOCK_COUNT; i++) {
+    ForkBlock *b = fork->blocks[blockLayout[i].id];
+    const unsigned char *now = raw + blockLayout[i].offset;
+
+    changed[i] = memcmp(now, b->data, b->size) != 0;
+    if (changed[i] && b->refs > 1) {
+      copies[i] = createBlock(now, b->size);
+      if (!copies[i]) {
+        for (int j = 0; j < i; j++)
+          free(copies[j]);
+        return WORLD_EVENT_NONE;
+      }
+    }
+  }
+
+  // 3. Commit: private blocks are updated in place, shared ones replaced
+  for (int i = 0; i < FORK_BLOCK_COUNT; i++) {
+    ForkBlock **slot = &fork->blocks[blockLayout[i].id];
+    if (copies[i]) {
+      releaseBlock(*slot);
+      *slot = copies[i];
+    } else if (changed[i]) {
+      memcpy((*slot)->data, raw + blockLayout[i].offset, (*slot)->size);
+    }
+  }
+  transferHot((unsigned char *)&scratch, fork->hot, false);
+  return events;
+}
+
+WorldForkStats getWorldForkStats(const WorldFork *fork) {
+  WorldForkStats stats = {0, 0, 0};
+  if (!fork)
+    return stats;
+
+  stats.privateBytes = sizeof(WorldFork);
+  for (int i = 0; i < FORK_BLOCK_COUNT; i++) {
+    const ForkBlock *b = fork->blocks[i];
+    size_t bytes = sizeof(ForkBlock) + b->size;
+
+    if (b->refs > 1) {
+      stats.sharedBytes += bytes;
+      stats.sharedBlocks++;
+    } else {
+      stats.privateBytes += bytes;
+    }
+  }
+  return stats;
+}
@@ -0,0 +1,346 @@
+#include "../../includes/sim_float.h"
+#include "../../includes/world_hash.h"
+#include <string.h>
+
+static const char *const partNames[WORLD_PART_COUNT] = {
+    "player", "swarm", "projectiles", "explosions", "bunkers", "level"};
+
+// ==========================================
+//               HASH
+// ==========================================
+
+/** @brief Odd constant of the mixing step (2^64 / golden ratio). */
+#define HASH_PRIME 0x9E3779B97F4A7C15ULL
+
+/** @brief The 32 bits of a Fixed (a position, a size or a speed). */
+static inline uint32_t fixedBits(Fixed v) { return (uint32_t)v; }
+
+/** @brief Two 32-bit values as one 64-bit word. */
+static inline uint64_t pack(uint32_t low, uint32_t high) {
+  return (uint64_t)high << 32 | low;
+}
+
+/**
+ * @brief Adds one word: rotate the hash, add the word times an odd
+ * constant. The products do not depend on each other, so the CPU computes
+ * several at once (a chain of multiplications would cost their whole
+ * latency per word); the rotation makes the order of the words matter,
+ * and keeps a change in the top bit of two words from cancelling out.
+ */
+static inline uint64_t addHash(uint64_t hash, uint64_t word) {
+  return (hash << 7 | hash >> 57) + word * HASH_PRIME;
+}
+
+/** @brief SplitMix64 finalizer: every input bit reaches every output bit. */
+static inline uint64_t finishHash(uint64_t hash) {
+  hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+  return hash ^ (hash >> 31);
+}
+
+static uint64_t hashPlayer(const Player *p) {
+  uint64_t h = WORLD_PART_PLAYER + 1;
+  h = addHash(h, pack(fixedBits(p->x), fixedBits(p->y)));
+  h = addHash(h, pack(p->width, p->height));
+  h = addHash(h, pack(fixedBits(p->velocityX), p->health));
+  h = addHash(h, pack(p->score, p->highScore));
+  h = addHash(h, p->shootReadyAt);
+  h = addHash(h, p->animAt);
+  h = addHash(h, pack((uint32_t)p->animFrame, (uint32_t)p->animDir));
+  return h;
+}
+
+/**
+ * @brief enemies[].active (through Swarm.enemyHash) and both alive masks
+ * are hashed: they hold the same information, and a step that updates one
+ * without the others is exactly the desync to catch.
+ */
+static uint64_t hashSwarm(const Swarm *s) {
+  const SwarmAlive *alive = &s->alive;
+  const Boss *boss = &s->boss;
+  uint64_t h = WORLD_PART_SWARM + 1;
+  h = addHash(h, s->enemyHash);
+  for (int r = 0; r < ENEMY_ROWS; r += 2) {
+    uint32_t next = r + 1 < ENEMY_ROWS ? alive->rows[r + 1] : 0;
+    h = addHash(h, pack(alive->rows[r], next));
+  }
+  uint64_t cols[2] = {0, 0}; // ENEMY_COLS <= 16 bytes
+  memcpy(cols, alive->cols, sizeof(alive->cols));
+  h = addHash(h, cols[0]);
+  h = addHash(h, cols[1]);
+  h = addHash(h, pack(fixedBits(s->originX), fixedBits(s->originY)));
+  h = addHash(h, pack((uint32_t)s->direction, s->aliveCount));
+  h = addHash(h, s->lastMoveAt);
+  h = addHash(h, s->moveInterval);
+  h = addHash(h, s->shootAt);
+  h = addHash(h, s->shootCooldown);
+  h = addHash(h, pack((uint32_t)s->level,
+                      (uint32_t)s->kind << 1 | s->animationFrame));
+  h = addHash(h, s->rng.state);
+
+  h = addHash(h, pack(boss->active, (uint32_t)boss->direction));
+  h = addHash(h, pack(fixedBits(boss->x), fixedBits(boss->y)));
+  h = addHash(h, pack(fixedBits(boss->width), fixedBits(boss->height)));
+  h = addHash(h, pack((uint32_t)boss->health, (uint32_t)boss->maxHealth));
+  return h;
+}
+
+static uint64_t hashProjectiles(const Projectiles *p) {
+  uint64_t h = WORLD_PART_PROJECTILES + 1;
+  h = addHash(h, pack(p->count, p->capacity));
+  for (unsigned k = 0; k < p->count; k++) {
+    h = addHash(h, pack(fixedBits(p->x[k]), fixedBits(p->y[k])));
+    h = addHash(h,
+                pack(fixedBits(p->velocityX[k]), fixedBits(p->velocityY[k])));
+    h = addHash(h, pack(fixedBits(p->prevX[k]), fixedBits(p->prevY[k])));
+  }
+  return h;
+}
+
+/** @brief The slot of an explosion is hashed too: it decides the reuse. */
+static uint64_t hashExplosions(const ExplosionManager *em) {
+  uint64_t h = WORLD_PART_EXPLOSIONS + 1;
+  for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    const Explosion *e = &em->explosions[i];
+    if (!e->active)
+      continue;
+    h = addHash(h, pack((uint32_t)i, (uint32_t)e->currentFrame));
+    h = addHash(h, pack(fixedBits(e->x), fixedBits(e->y)));
+    h = addHash(h, e->nextFrameAt);
+  }
+  return h;
+}
+
+static uint64_t hashBunkers(const BunkerManager *bm) {
+  uint64_t h = WORLD_PART_BUNKERS + 1;
+  for (int i = 0; i < BUNKER_COUNT; i++) {
+    const Bunker *b = &bm->bunkers[i];
+    h = addHash(h, pack(fixedBits(b->x), fixedBits(b->y)));
+    h = addHash(h, b->hash);
+  }
+  return h;
+}
+
+static uint64_t hashLevel(const World *w) {
+  uint64_t h = WORLD_PART_LEVEL + 1;
+  h = addHash(h, pack(w->screenWidth, w->screenHeight));
+  h = addHash(h, pack((uint32_t)w->startLevel, (uint32_t)w->currentLevel));
+  h = addHash(h, pack((uint32_t)w->state, w->playerWon));
+  h = addHash(h, w->clock);
+  return h;
+}
+
+void hashWorldParts(const World *world, WorldHash *hash) {
+  hash->parts[WORLD_PART_PLAYER] = hashPlayer(&world->player);
+  hash->parts[WORLD_PART_SWARM] = hashSwarm(&world->swarm);
+  hash->parts[WORLD_PART_PROJECTILES] = hashProjectiles(&world->projectiles);
+  hash->parts[WORLD_PART_EXPLOSIONS] = hashExplosions(&world->explosions);
+  hash->parts[WORLD_PART_BUNKERS] = hashBunkers(&world->bunkers);
+  hash->parts[WORLD_PART_LEVEL] = hashLevel(world);
+
+  uint64_t total = WORLD_PART_COUNT + 1;
+  for (int i = 0; i < WORLD_PART_COUNT; i++)
+    total = addHash(total, hash->parts[i]);
+  hash->total = finishHash(total);
+}
+
+uint64_t hashWorld(const World *world) {
+  WorldHash hash;
+  hashWorldParts(world, &hash);
+  return hash.total;
+}
+
+const char *getWorldPartName(WorldPart part) {
+  if (part < 0 || part >= WORLD_PART_COUNT)
+    return "?";
+  return partNames[part];
+}
+
+// ==========================================
+//               DIFF
+// ==========================================
+
+/** @brief State of one printWorldDiff() call. */
+typedef struct {
+  FILE *out;
+  int maxLines;
+  int count; /**< Differing fields so far. */
+} WorldDiff;
+
+/** @brief Counts a differing field, and prints its name if room is left. */
+static bool beginField(WorldDiff *d, const char *name, int index) {
+  if (d->count++ >= d->maxLines)
+    return false;
+  if (index >= 0)
+    fprintf(d->out, "  %s[%d]: ", name, index);
+  else
+    fprintf(d->out, "  %s: ", name);
+  return true;
+}
+
+static void diffFixed(WorldDiff *d, const char *name, int index, Fixed a,
+                      Fixed b) {
+  if (a != b && beginField(d, name, index))
+    fprintf(d->out, "%.6f (0x%08x) != %.6f (0x%08x)\n", fixedToFloat(a),
+            (unsigned)fixedBits(a), fixedToFloat(b), (unsigned)fixedBits(b));
+}
+
+static void diffInt(WorldDiff *d, const char *name, int index, long long a,
+                    long long b) {
+  if (a != b && beginField(d, name, index))
+    fprintf(d->out, "%lld != %lld\n", a, b);
+}
+
+static void diffHex(WorldDiff *d, const char *name, int index, uint64_t a,
+                    uint64_t b) {
+  if (a != b && beginField(d, name, index))
+    fprintf(d->out, "%016llx != %016llx\n", (unsigned long long)a,
+            (unsigned long long)b);
+}
+
+static void diffPlayer(WorldDiff *d, const Player *a, const Player *b) {
+  diffFixed(d, "player.x", -1, a->x, b->x);
+  diffFixed(d, "player.y", -1, a->y, b->y);
+  diffInt(d, "player.width", -1, a->width, b->width);
+  diffInt(d, "player.height", -1, a->height, b->height);
+  diffFixed(d, "player.velocityX", -1, a->velocityX, b->velocityX);
+  diffInt(d, "player.shootReadyAt", -1, a->shootReadyAt, b->shootReadyAt);
+  diffInt(d, "player.health", -1, a->health, b->health);
+  diffInt(d, "player.score", -1, a->score, b->score);
+  diffInt(d, "player.highScore", -1, a->highScore, b->highScore);
+  diffInt(d, "player.animAt", -1, a->animAt, b->animAt);
+  diffInt(d, "player.animFrame", -1, a->animFrame, b->animFrame);
+  diffInt(d, "player.animDir", -1, a->animDir, b->animDir);
+}
+
+static void diffSwarm(WorldDiff *d, const Swarm *a, const Swarm *b) {
+  for (int j = 0; j < TOTAL_ENEMIES; j++)
+    diffInt(d, "swarm.enemies.active", j, a->enemies[j].active,
+            b->enemies[j].active);
+  for (int r = 0; r < ENEMY_ROWS; r++)
+    diffHex(d, "swarm.alive.rows", r, a->alive.rows[r], b->alive.rows[r]);
+  for (int c = 0; c < ENEMY_COLS; c++)
+    diffHex(d, "swarm.alive.cols", c, a->alive.cols[c], b->alive.cols[c]);
+  diffFixed(d, "swarm.originX", -1, a->originX, b->originX);
+  diffFixed(d, "swarm.originY", -1, a->originY, b->originY);
+  diffInt(d, "swarm.direction", -1, a->direction, b->direction);
+  diffInt(d, "swarm.lastMoveAt", -1, a->lastMoveAt, b->lastMoveAt);
+  diffInt(d, "swarm.moveInterval", -1, a->moveInterval, b->moveInterval);
+  diffInt(d, "swarm.shootAt", -1, a->shootAt, b->shootAt);
+  diffInt(d, "swarm.shootCooldown", -1, a->shootCooldown, b->shootCooldown);
+  diffInt(d, "swarm.aliveCount", -1, a->aliveCount, b->aliveCount);
+  diffInt(d, "swarm.level", -1, a->level, b->level);
+  diffInt(d, "swarm.kind", -1, a->kind, b->kind);
+  diffInt(d, "swarm.animationFrame", -1, a->animationFrame,
+          b->animationFrame);
+  diffHex(d, "swarm.rng.state", -1, a->rng.state, b->rng.state);
+  diffHex(d, "swarm.enemyHash", -1, a->enemyHash, b->enemyHash);
+
+  // The incremental hash must follow enemies[]
+  diffHex(d, "swarm.enemyHash (A vs its enemies)", -1, a->enemyHash,
+          hashSwarmEnemies(a));
+  diffHex(d, "swarm.enemyHash (B vs its enemies)", -1, b->enemyHash,
+          hashSwarmEnemies(b));
+
+  const Boss *ba = &a->boss, *bb = &b->boss;
+  diffInt(d, "swarm.boss.active", -1, ba->active, bb->active);
+  diffFixed(d, "swarm.boss.x", -1, ba->x, bb->x);
+  diffFixed(d, "swarm.boss.y", -1, ba->y, bb->y);
+  diffFixed(d, "swarm.boss.width", -1, ba->width, bb->width);
+  diffFixed(d, "swarm.boss.height", -1, ba->height, bb->height);
+  diffInt(d, "swarm.boss.health", -1, ba->health, bb->health);
+  diffInt(d, "swarm.boss.maxHealth", -1, ba->maxHealth, bb->maxHealth);
+  diffInt(d, "swarm.boss.direction", -1, ba->direction, bb->direction);
+}
+
+static void diffProjectiles(WorldDiff *d, const Projectiles *a,
+                            const Projectiles *b) {
+  diffInt(d, "projectiles.count", -1, a->count, b->count);
+  diffInt(d, "projectiles.capacity", -1, a->capacity, b->capacity);
+  unsigned count = a->count < b->count ? a->count : b->count;
+  for (unsigned k = 0; k < count; k++) {
+    diffFixed(d, "projectiles.x", (int)k, a->x[k], b->x[k]);
+    diffFixed(d, "projectiles.y", (int)k, a->y[k], b->y[k]);
+    diffFixed(d, "projectiles.velocityX", (int)k, a->velocityX[k],
+              b->velocityX[k]);
+    diffFixed(d, "projectiles.velocityY", (int)k, a->velocityY[k],
+              b->velocityY[k]);
+    diffFixed(d, "projectiles.prevX", (int)k, a->prevX[k], b->prevX[k]);
+    diffFixed(d, "projectiles.prevY", (int)k, a->prevY[k], b->prevY[k]);
+  }
+}
+
+static void diffExplosions(WorldDiff *d, const ExplosionManager *a,
+                           const ExplosionManager *b) {
+  for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    const Explosion *ea = &a->explosions[i], *eb = &b->explosions[i];
+    diffInt(d, "explosions.active", i, ea->active, eb->active);
+    if (!ea->active || !eb->active)
+      continue;
+    diffFixed(d, "explosions.x", i, ea->x, eb->x);
+    diffFixed(d, "explosions.y", i, ea->y, eb->y);
+    diffInt(d, "explosions.nextFrameAt", i, ea->nextFrameAt, eb->nextFrameAt);
+    diffInt(d, "explosions.currentFrame", i, ea->currentFrame,
+            eb->currentFrame);
+  }
+}
+
+/** @brief Differing pixels of a bunker, reported as one field. */
+static void diffBunkerPixels(WorldDiff *d, int index, const Bunker *a,
+                             const Bunker *b) {
+  int count = 0, firstX = 0, firstY = 0;
+  for (int py = 0; py < BUNKER_PIXEL_HEIGHT; py++) {
+    for (int w = 0; w < BUNKER_ROW_WORDS; w++) {
+      unsigned bits = a->pixels[py][w] ^ b->pixels[py][w];
+      if (bits && !count) {
+        firstX = w * BUNKER_WORD_BITS + __builtin_ctz(bits);
+        firstY = py;
+      }
+      count += __builtin_popcount(bits);
+    }
+  }
+  if (count && beginField(d, "bunkers.pixels", index))
+    fprintf(d->out, "%d pixels differ (first: %d, %d)\n", count, firstX,
+            firstY);
+}
+
+static void diffBunkers(WorldDiff *d, const BunkerManager *a,
+                        const BunkerManager *b) {
+  for (int i = 0; i < BUNKER_COUNT; i++) {
+    const Bunker *ba = &a->bunkers[i], *bb = &b->bunkers[i];
+    diffFixed(d, "bunkers.x", i, ba->x, bb->x);
+    diffFixed(d, "bunkers.y", i, ba->y, bb->y);
+    diffBunkerPixels(d, i, ba, bb);
+    diffHex(d, "bunkers.hash", i, ba->hash, bb->hash);
+
+    // The incremental hash must follow the bitmap
+    diffHex(d, "bunkers.hash (A vs its pixels)", i, ba->hash,
+            hashBunkerPixels(ba));
+    diffHex(d, "bunkers.hash (B vs its pixels)", i, bb->hash,
+            hashBunkerPixels(bb));
+  }
+}
+
+static void diffLevel(WorldDiff *d, const World *a, const World *b) {
+  diffInt(d, "screenWidth", -1, a->screenWidth, b->screenWidth);
+  diffInt(d, "screenHeight", -1, a->screenHeight, b->screenHeight);
+  diffInt(d, "startLevel", -1, a->startLevel, b->startLevel);
+  diffInt(d, "currentLevel", -1, a->currentLevel, b->currentLevel);
+  diffInt(d, "state", -1, a->state, b->state);
+  diffInt(d, "playerWon", -1, a->playerWon, b->playerWon);
+  diffInt(d, "clock", -1, a->clock, b->clock);
+}
+
+int printWorldDiff(FILE *out, const World *a, const World *b, int maxLines) {
+  WorldDiff d = {out, maxLines, 0};
+  diffPlayer(&d, &a->player, &b->player);
+  diffSwarm(&d, &a->swarm, &b->swarm);
+  diffProjectiles(&d, &a->projectiles, &b->projectiles);
+  diffExplosions(&d, &a->explosions, &b->explosions);
+  diffBunkers(&d, &a->bunkers, &b->bunkers);
+  diffLevel(&d, a, b);
+
+  if (d.count > maxLines)
+    fprintf(out, "  ... and %d more\n", d.count - maxLines);
+  return d.count;
+}
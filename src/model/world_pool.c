@@ -0,0 +1,334 @@
+#define _GNU_SOURCE // pthread_setaffinity_np()
+#include "../../includes/sim_float.h"
+#include "../../includes/world_pool.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================
+//               STRUCTURES
+// ==========================================
+
+/**
+ * @brief One game and its I/O, alone on its cache lines.
+ */
+typedef struct {
+  _Alignas(WORLD_POOL_CACHE_LINE) World world;
+  WorldAction action; /**< Input used when there is no policy. */
+  unsigned events;    /**< Result of the last step. */
+} PoolSlot;
+
+/**
+ * @brief Work-stealing deque of one thread (Chase-Lev).
+ * The tasks are the chunk indices in [top, bottom): the owner takes from
+ * `bottom`, thieves take from `top`. Tasks are only added between steps,
+ * so no buffer is needed.
+ */
+typedef struct {
+  _Alignas(WORLD_POOL_CACHE_LINE) atomic_long top;
+  _Alignas(WORLD_POOL_CACHE_LINE) atomic_long bottom;
+} PoolDeque;
+
+/**
+ * @brief Per-thread state, padded to avoid false sharing.
+ */
+typedef struct {
+  _Alignas(WORLD_POOL_CACHE_LINE) PoolDeque deque;
+  unsigned long long steals; /**< Only written by its own thread. */
+  pthread_t thread;
+  int id;
+  WorldPool *pool;
+} PoolWorker;
+
+struct WorldPool {
+  PoolSlot *slots;
+  int worldCount;
+  long chunkCount;
+  bool autoReset;
+  bool pinThreads;
+  WorldPolicy policy;
+  void *policyUser;
+
+  PoolWorker *workers; /**< workers[0] is the calling thread. */
+  int threadCount;
+  int startedThreads; /**< Worker threads actually running. */
+
+  // Step hand-off (protected by `lock`)
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  pthread_cond_t done;
+  unsigned long generation; /**< Incremented at every step. */
+  int running;              /**< Workers still busy with this step. */
+  bool shutdown;
+  float deltaTime;
+};
+
+/** @brief steal() result when another thread won the race. */
+#define STEAL_RETRY (-2)
+
+// ==========================================
+//               DEQUE
+// ==========================================
+
+/** @brief Owner side: takes the last chunk, or returns -1 if empty. */
+static long popChunk(PoolDeque *d) {
+  long b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+  atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  long t = atomic_load_explicit(&d->top, memory_order_relaxed);
+
+  if (t > b) {
+    atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+    return -1;
+  }
+  if (t < b)
+    return b;
+
+  // Last chunk: race against thieves for it
+  bool won = atomic_compare_exchange_strong_explicit(
+      &d->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+  atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+  return won ? b : -1;
+}
+
+/** @brief Thief side: takes the first chunk, -1 if empty, or STEAL_RETRY. */
+static long stealChunk(PoolDeque *d) {
+  long t = atomic_load_explicit(&d->top, memory_order_acquire);
+  atomic_thread_fence(memory_order_seq_cst);
+  long b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+
+  if (t >= b)
+    return -1;
+  if (atomic_compare_exchange_strong_explicit(
+          &d->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+    return t;
+  return STEAL_RETRY;
+}
+
+// ==========================================
+//               WORKERS
+// ==========================================
+
+/** @brief Steps the WORLD_POOL_CHUNK worlds of one chunk. */
+static void runChunk(WorldPool *pool, long chunk, float deltaTime) {
+  int first = (int)(chunk * WORLD_POOL_CHUNK);
+  int end = first + WORLD_POOL_CHUNK;
+  if (end > pool->worldCount)
+    end = pool->worldCount;
+
+  for (int i = first; i < end; i++) {
+    PoolSlot *slot = &pool->slots[i];
+    WorldAction action = pool->policy
+                             ? pool->policy(&slot->world, pool->policyUser)
+                             : slot->action;
+
+    slot->events = stepWorld(&slot->world, action, deltaTime);
+    if (pool->autoReset && slot->world.state == STATE_GAME_OVER)
+      resetWorld(&slot->world);
+  }
+}
+
+/** @brief Drains its own deque, then steals until every deque is empty. */
+static void runWorker(WorldPool *pool, PoolWorker *self, float deltaTime) {
+  long chunk;
+  while ((chunk = popChunk(&self->deque)) >= 0)
+    runChunk(pool, chunk, deltaTime);
+
+  bool busy = true;
+  while (busy) {
+    busy = false;
+    for (int k = 1; k < pool->threadCount; k++) {
+      PoolWorker *victim = &pool->workers[(self->id + k) % pool->threadCount];
+      chunk = stealChunk(&victim->deque);
+
+      if (chunk >= 0) {
+        self->steals++;
+        runChunk(pool, chunk, deltaTime);
+        busy = true;
+      } else if (chunk == STEAL_RETRY) {
+        busy = true;
+      }
+    }
+  }
+}
+
+/** @brief Pins the calling thread to CPU `cpu` (best effort). */
+static void pinThread(int cpu) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % CPU_SETSIZE, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpu;
+#endif
+}
+
+static void *workerMain(void *arg) {
+  PoolWorker *self = (PoolWorker *)arg;
+  WorldPool *pool = self->pool;
+  unsigned long seen = 0;
+
+  if (pool->pinThreads)
+    pinThread(self->id);
+
+  for (;;) {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->generation == seen && !pool->shutdown)
+      pthread_cond_wait(&pool->start, &pool->lock);
+    if (pool->shutdown) {
+      pthread_mutex_unlock(&pool->lock);
+      break;
+    }
+    seen = pool->generation;
+    float deltaTime = pool->deltaTime;
+    pthread_mutex_unlock(&pool->lock);
+
+    runWorker(pool, self, deltaTime);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0)
+      pthread_cond_signal(&pool->done);
+    pthread_mutex_unlock(&pool->lock);
+  }
+  return NULL;
+}
+
+// ==========================================
+//           PUBLIC FUNCTIONS
+// ==========================================
+
+WorldPool *createWorldPool(const WorldPoolConfig *config) {
+  if (!config || config->worldCount <= 0 || config->threadCount < 1)
+    return NULL;
+
+  WorldPool *pool = (WorldPool *)calloc(1, sizeof(WorldPool));
+  if (!pool)
+    return NULL;
+
+  pool->worldCount = config->worldCount;
+  pool->chunkCount =
+      (config->worldCount + WORLD_POOL_CHUNK - 1) / WORLD_POOL_CHUNK;
+  pool->threadCount = config->threadCount;
+  pool->autoReset = config->autoReset;
+  pool->pinThreads = config->pinThreads;
+  pool->policy = config->policy;
+  pool->policyUser = config->policyUser;
+
+  pool->slots = (PoolSlot *)aligned_alloc(
+      WORLD_POOL_CACHE_LINE, config->worldCount * sizeof(PoolSlot));
+  pool->workers = (PoolWorker *)aligned_alloc(
+      WORLD_POOL_CACHE_LINE, config->threadCount * sizeof(PoolWorker));
+  if (!pool->slots || !pool->workers) {
+    free(pool->slots);
+    free(pool->workers);
+    free(pool);
+    return NULL;
+  }
+
+  memset(pool->slots, 0, config->worldCount * sizeof(PoolSlot));
+  for (int i = 0; i < config->worldCount; i++) {
+    initWorld(&pool->slots[i].world, config->screenWidth, config->screenHeight,
+              config->level, config->seed + (uint64_t)i);
+  }
+
+  memset(pool->workers, 0, config->threadCount * sizeof(PoolWorker));
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+
+  for (int t = 0; t < pool->threadCount; t++) {
+    pool->workers[t].id = t;
+    pool->workers[t].pool = pool;
+    atomic_init(&pool->workers[t].deque.top, 0);
+    atomic_init(&pool->workers[t].deque.bottom, 0);
+  }
+  for (int t = 1; t < pool->threadCount; t++) {
+    if (pthread_create(&pool->workers[t].thread, NULL, workerMain,
+                       &pool->workers[t]) != 0) {
+      destroyWorldPool(pool);
+      return NULL;
+    }
+    pool->startedThreads++;
+  }
+  return pool;
+}
+
+void destroyWorldPool(WorldPool *pool) {
+  if (!pool)
+    return;
+
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdown = true;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (int t = 1; t <= pool->startedThreads; t++)
+    pthread_join(pool->workers[t].thread, NULL);
+
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->start);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->workers);
+  free(pool->slots);
+  free(pool);
+}
+
+void stepWorldPool(WorldPool *pool, float deltaTime) {
+  if (!pool)
+    return;
+
+  // 1. Deal contiguous chunk ranges (worker t keeps the same worlds)
+  pthread_mutex_lock(&pool->lock);
+  for (int t = 0; t < pool->threadCount; t++) {
+    PoolDeque *d = &pool->workers[t].deque;
+    long first = pool->chunkCount * t / pool->threadCount;
+    long end = pool->chunkCount * (t + 1) / pool->threadCount;
+    atomic_store_explicit(&d->top, first, memory_order_relaxed);
+    atomic_store_explicit(&d->bottom, end, memory_order_relaxed);
+  }
+  pool->deltaTime = deltaTime;
+  pool->running = pool->startedThreads;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  // 2. The caller works as thread 0
+  runWorker(pool, &pool->workers[0], deltaTime);
+
+  // 3. Wait for the others
+  pthread_mutex_lock(&pool->lock);
+  while (pool->running > 0)
+    pthread_cond_wait(&pool->done, &pool->lock);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+void setWorldPoolAction(WorldPool *pool, int index, WorldAction action) {
+  if (pool && index >= 0 && index < pool->worldCount)
+    pool->slots[index].action = action;
+}
+
+World *getWorldPoolWorld(WorldPool *pool, int index) {
+  if (!pool || index < 0 || index >= pool->worldCount)
+    return NULL;
+  return &pool->slots[index].world;
+}
+
+unsigned getWorldPoolEvents(const WorldPool *pool, int index) {
+  if (!pool || index < 0 || index >= pool->worldCount)
+    return WORLD_EVENT_NONE;
+  return pool->slots[index].events;
+}
+
+unsigned long long getWorldPoolSteals(const WorldPool *pool) {
+  unsigned long long total = 0;
+  if (!pool)
+    return total;
+
+  // Only called between steps: the workers are idle
+  for (int t = 0; t < pool->threadCount; t++)
+    total += pool->workers[t].steals;
+  return total;
+}
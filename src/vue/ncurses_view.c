@@ -7,16 +7,16 @@
  * @brief Helper: Maps Game X (0.0 -> gameWidth) to Terminal Col (0 -> COLS).
  * Handles the aspect ratio scaling.
  */
-static int mapX(Ncurses_Context *ctx, float x) {
+static int mapX(Ncurses_Context *ctx, Fixed x) {
   // Formula: (EntityPosition / TotalGameWidth) * TotalTerminalColumns
-  return (int)((x / (float)ctx->gameWidth) * ctx->cols);
+  return (int)((fixedToFloat(x) / (float)ctx->gameWidth) * ctx->cols);
 }
 
 /**
  * @brief Helper: Maps Game Y (0.0 -> gameHeight) to Terminal Row (0 -> ROWS).
  */
-static int mapY(Ncurses_Context *ctx, float y) {
-  return (int)((y / (float)ctx->gameHeight) * ctx->rows);
+static int mapY(Ncurses_Context *ctx, Fixed y) {
+  return (int)((fixedToFloat(y) / (float)ctx->gameHeight) * ctx->rows);
 }
 
 Ncurses_Context *initNcursesView(unsigned width, unsigned height) {
@@ -50,6 +50,64 @@ void destroyNcursesView(Ncurses_Context *ctx) {
   }
 }
 
+/** @brief Standard Enemies (Simple 'M'), for SWARM_GRID. */
+static void drawGrid(Ncurses_Context *ctx, const Swarm *s) {
+  for (int i = 0; i < TOTAL_ENEMIES; i++) {
+    if (s->enemies[i].active)
+      mvaddch(mapY(ctx, getEnemyY(s, i)), mapX(ctx, getEnemyX(s, i)), 'M');
+  }
+}
+
+/** @brief Boss (Complex Multi-line ASCII Art), for SWARM_BOSS. */
+static void drawBoss(Ncurses_Context *ctx, const Swarm *s) {
+  if (!s->boss.active)
+    return;
+
+  // Calculate Boss Hitbox Width in Columns
+  float bossWidth = fixedToFloat(s->boss.width);
+  int bossWidthCols = (int)((bossWidth / (float)ctx->gameWidth) * ctx->cols);
+  if (bossWidthCols < 6)
+    bossWidthCols = 6; // Min size for visual clarity
+
+  int bx = mapX(ctx, s->boss.x);
+  int by = mapY(ctx, s->boss.y);
+
+  // Draw HP Bar
+  mvprintw(by - 1, bx, "BOSS HP:%d", s->boss.health);
+
+  // Draw Mothership Sprite Logic:
+  // Top:    /--------\    
+  // Middle: | O  O  O |
+  // Bottom: \--------/
+  for (int i = 0; i < bossWidthCols; i++) {
+    char top = '-', mid = ' ', bot = '-';
+
+    if (i == 0) {
+      top = '/';
+      mid = '|';
+      bot = '\\'; // Left Edge
+    } else if (i == bossWidthCols - 1) {
+      top = '\\';
+      mid = '|';
+      bot = '/'; // Right Edge
+    } else {
+      if (i % 2 != 0)
+        mid = '0'; // Lights/Windows in middle
+    }
+
+    mvaddch(by, bx + i, top);
+    mvaddch(by + 1, bx + i, mid);
+    mvaddch(by + 2, bx + i, bot);
+  }
+}
+
+/** @brief How each SwarmKind is drawn. */
+static void (*const drawSwarmKinds[SWARM_KIND_COUNT])(Ncurses_Context *,
+                                                      const Swarm *) = {
+    [SWARM_GRID] = drawGrid,
+    [SWARM_BOSS] = drawBoss,
+};
+
 void renderNcurses(Ncurses_Context *ctx, const Player *p,
                    const Projectiles *prj, const Swarm *s,
                    const ExplosionManager *ex, const BunkerManager *b,
@@ -103,71 +161,29 @@ void renderNcurses(Ncurses_Context *ctx, const Player *p,
     }
 
     // 2. RENDER ENEMIES & BOSS
-    if (s) {
-      // A. Standard Enemies (Simple 'M')
-      for (int i = 0; i < TOTAL_ENEMIES; i++) {
-        if (s->enemies[i].active)
-          mvaddch(mapY(ctx, s->enemies[i].y), mapX(ctx, s->enemies[i].x), 'M');
-      }
-
-      // B. Boss (Complex Multi-line ASCII Art)
-      if (s->level == 2 && s->boss.active) {
-        // Calculate Boss Hitbox Width in Columns
-        int bossWidthCols =
-            (int)((s->boss.width / (float)ctx->gameWidth) * ctx->cols);
-        if (bossWidthCols < 6)
-          bossWidthCols = 6; // Min size for visual clarity
-
-        int bx = mapX(ctx, s->boss.x);
-        int by = mapY(ctx, s->boss.y);
-
-        // Draw HP Bar
-        mvprintw(by - 1, bx, "BOSS HP:%d", s->boss.health);
-
-        // Draw Mothership Sprite Logic:
-        // Top:    /--------\    
-        // Middle: | O  O  O |
-        // Bottom: \--------/
-        for (int i = 0; i < bossWidthCols; i++) {
-          char top = '-', mid = ' ', bot = '-';
-
-          if (i == 0) {
-            top = '/';
-            mid = '|';
-            bot = '\\'; // Left Edge
-          } else if (i == bossWidthCols - 1) {
-            top = '\\';
-            mid = '|';
-            bot = '/'; // Right Edge
-          } else {
-            if (i % 2 != 0)
-              mid = '0'; // Lights/Windows in middle
-          }
-
-          mvaddch(by, bx + i, top);
-          mvaddch(by + 1, bx + i, mid);
-          mvaddch(by + 2, bx + i, bot);
-        }
-      }
-    }
+    if (s)
+      drawSwarmKinds[s->kind](ctx, s);
 
     // 3. RENDER PROJECTILES
     if (prj) {
-      for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (prj->projectiles[i].active)
-          mvaddch(mapY(ctx, prj->projectiles[i].y),
-                  mapX(ctx, prj->projectiles[i].x), '|');
-      }
+      for (unsigned i = 0; i < prj->count; i++)
+        mvaddch(mapY(ctx, prj->y[i]), mapX(ctx, prj->x[i]), '|');
     }
 
     // 4. RENDER BUNKERS
     if (b) {
       for (int k = 0; k < BUNKER_COUNT; k++) {
-        for (int i = 0; i < BUNKER_ROWS * BUNKER_COLS; i++) {
-          // Draw individual active blocks
-          if (b->bunkers[k].blocks[i].active)
-            mvaddch(mapY(ctx, b->bunkers[k].blocks[i].y),
-                    mapX(ctx, b->bunkers[k].blocks[i].x), '#');
+        const Bunker *bunker = &b->bunkers[k];
+        for (int row = 0; row < BUNKER_ROWS; row++) {
+          for (int col = 0; col < BUNKER_COLS; col++) {
+            // One character per block: drawn while half of it stands
+            int px = col * BLOCK_PIXELS, py = row * BLOCK_PIXELS;
+            int intact = countBunkerPixels(bunker, px, py, px + BLOCK_PIXELS,
+                                           py + BLOCK_PIXELS);
+            if (2 * intact >= BLOCK_PIXELS * BLOCK_PIXELS)
+              mvaddch(mapY(ctx, bunker->y + FIXED(py)),
+                      mapX(ctx, bunker->x + FIXED(px)), '#');
+          }
         }
       }
     }
@@ -4,6 +4,7 @@
 #include <SDL3_ttf/SDL_ttf.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define LOGICAL_WIDTH 800
 #define LOGICAL_HEIGHT 600
@@ -17,6 +18,95 @@ SDL_Texture *loadTexture(SDL_Renderer *renderer, const char *path) {
   return tex;
 }
 
+/**
+ * @brief Samples bunker.png into the block tile and creates one transparent
+ * streaming texture per bunker (filled by updateBunkerTexture()).
+ */
+static void initBunkerTextures(SDL_Context *ctx) {
+  const SDL_PixelFormatDetails *rgba =
+      SDL_GetPixelFormatDetails(SDL_PIXELFORMAT_RGBA32);
+  Uint32 green = SDL_MapRGBA(rgba, NULL, 0, 255, 0, 255); // Fallback Green
+  for (int i = 0; i < BLOCK_PIXELS * BLOCK_PIXELS; i++)
+    ctx->bunkerTile[i] = green;
+
+  SDL_Surface *image = IMG_Load("assets/bunker.png");
+  SDL_Surface *surface =
+      image ? SDL_ConvertSurface(image, SDL_PIXELFORMAT_RGBA32) : NULL;
+  if (surface) {
+    for (int ty = 0; ty < BLOCK_PIXELS; ty++) {
+      int sy = (2 * ty + 1) * surface->h / (2 * BLOCK_PIXELS);
+      const Uint8 *line = (const Uint8 *)surface->pixels + sy * surface->pitch;
+      for (int tx = 0; tx < BLOCK_PIXELS; tx++) {
+        int sx = (2 * tx + 1) * surface->w / (2 * BLOCK_PIXELS);
+        memcpy(&ctx->bunkerTile[ty * BLOCK_PIXELS + tx], line + sx * 4, 4);
+      }
+    }
+    SDL_DestroySurface(surface);
+  } else {
+    printf("Failed to load texture 'assets/bunker.png': %s\n",
+           SDL_GetError());
+  }
+  if (image)
+    SDL_DestroySurface(image);
+
+  // The shadow bitmaps start empty (calloc), matching the cleared textures
+  static const Uint32 clear[BUNKER_PIXEL_WIDTH * BUNKER_PIXEL_HEIGHT];
+  for (int i = 0; i < BUNKER_COUNT; i++) {
+    SDL_Texture *tex = SDL_CreateTexture(
+        ctx->renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STREAMING,
+        BUNKER_PIXEL_WIDTH, BUNKER_PIXEL_HEIGHT);
+    if (!tex) {
+      printf("Failed to create bunker texture: %s\n", SDL_GetError());
+      continue;
+    }
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
+    SDL_UpdateTexture(tex, NULL, clear, BUNKER_PIXEL_WIDTH * sizeof(Uint32));
+    ctx->bunkerTextures[i] = tex;
+  }
+}
+
+/**
+ * @brief Re-uploads the part of bunker `index` that changed since the last
+ * upload: the bounding rectangle of the differing rows and words.
+ */
+static void updateBunkerTexture(SDL_Context *ctx, int index,
+                                const Bunker *bunker) {
+  BunkerRow(*shadow)[BUNKER_ROW_WORDS] = ctx->bunkerShadow[index];
+  int y0 = BUNKER_PIXEL_HEIGHT, y1 = 0;
+  int w0 = BUNKER_ROW_WORDS, w1 = 0;
+  for (int py = 0; py < BUNKER_PIXEL_HEIGHT; py++) {
+    for (int w = 0; w < BUNKER_ROW_WORDS; w++) {
+      if (shadow[py][w] != bunker->pixels[py][w]) {
+        y0 = py < y0 ? py : y0;
+        y1 = py + 1;
+        w0 = w < w0 ? w : w0;
+        w1 = w + 1 > w1 ? w + 1 : w1;
+      }
+    }
+  }
+  if (y0 >= y1)
+    return; // No damage since the last frame
+
+  int x0 = w0 * BUNKER_WORD_BITS;
+  int x1 = w1 * BUNKER_WORD_BITS;
+  if (x1 > BUNKER_PIXEL_WIDTH)
+    x1 = BUNKER_PIXEL_WIDTH;
+  SDL_Rect rect = {x0, y0, x1 - x0, y1 - y0};
+
+  Uint32 texels[BUNKER_PIXEL_WIDTH * BUNKER_PIXEL_HEIGHT];
+  for (int py = y0; py < y1; py++) {
+    Uint32 *out = texels + (py - y0) * rect.w;
+    const Uint32 *tile = ctx->bunkerTile + (py % BLOCK_PIXELS) * BLOCK_PIXELS;
+    for (int px = x0; px < x1; px++)
+      out[px - x0] = isBunkerPixelSet(bunker, px, py) ? tile[px % BLOCK_PIXELS]
+                                                       : 0; // Transparent
+    memcpy(shadow[py], bunker->pixels[py], sizeof(shadow[py]));
+  }
+  SDL_UpdateTexture(ctx->bunkerTextures[index], &rect, texels,
+                    rect.w * (int)sizeof(Uint32));
+}
+
 SDL_Context *initSDLView(unsigned windowWidth, unsigned windowHeight) {
   // --- 1. Initialize SDL Subsystems ---
   SDL_SetHint("SDL_RENDER_SCALE_QUALITY",
@@ -113,7 +203,7 @@ SDL_Context *initSDLView(unsigned windowWidth, unsigned windowHeight) {
   ctx->exhaustTexture[3] =
       loadTexture(ctx->renderer, "assets/player_fire_4.png");
 
-  ctx->bunkerTexture = loadTexture(ctx->renderer, "assets/bunker.png");
+  initBunkerTextures(ctx);
   ctx->bossTexture = loadTexture(ctx->renderer, "assets/boss.png");
 
   ctx->explosionTextures[0] =
@@ -181,8 +271,10 @@ void destroySDLView(SDL_Context *ctx) {
     SDL_DestroyTexture(ctx->enemyProjectileTexture);
   if (ctx->bossTexture)
     SDL_DestroyTexture(ctx->bossTexture);
-  if (ctx->bunkerTexture)
-    SDL_DestroyTexture(ctx->bunkerTexture);
+  for (int i = 0; i < BUNKER_COUNT; i++) {
+    if (ctx->bunkerTextures[i])
+      SDL_DestroyTexture(ctx->bunkerTextures[i]);
+  }
 
   // Clean Arrays
   for (int i = 0; i < 3; i++) {
@@ -280,6 +372,64 @@ void playSound(SDL_Context *ctx, SoundEffect effect) {
   }
 }
 
+/** @brief The grid of a SWARM_GRID level. */
+static void drawGrid(SDL_Context *ctx, const Swarm *swarm) {
+  // Toggle texture for animation effect
+  SDL_Texture *currentAlien =
+      swarm->animationFrame ? ctx->enemyTexture2 : ctx->enemyTexture1;
+
+  for (int i = 0; i < TOTAL_ENEMIES; i++) {
+    if (swarm->enemies[i].active) {
+      SDL_FRect enemyRect = {fixedToFloat(getEnemyX(swarm, i)),
+                             fixedToFloat(getEnemyY(swarm, i)),
+                             (float)swarm->enemies[i].width,
+                             (float)swarm->enemies[i].height};
+
+      if (currentAlien) {
+        SDL_RenderTexture(ctx->renderer, currentAlien, NULL, &enemyRect);
+      } else {
+        SDL_SetRenderDrawColor(ctx->renderer, 255, 0, 0, 255);
+        SDL_RenderFillRect(ctx->renderer, &enemyRect);
+      }
+    }
+  }
+}
+
+/** @brief The Boss of a SWARM_BOSS level and its health bar. */
+static void drawBoss(SDL_Context *ctx, const Swarm *swarm) {
+  if (!swarm->boss.active)
+    return;
+
+  float x = fixedToFloat(swarm->boss.x), y = fixedToFloat(swarm->boss.y);
+  float width = fixedToFloat(swarm->boss.width);
+  SDL_FRect bossRect = {x, y, width, fixedToFloat(swarm->boss.height)};
+
+  if (ctx->bossTexture) {
+    SDL_RenderTexture(ctx->renderer, ctx->bossTexture, NULL, &bossRect);
+  } else {
+    SDL_SetRenderDrawColor(ctx->renderer, 255, 0, 0, 255);
+    SDL_RenderFillRect(ctx->renderer, &bossRect);
+  }
+
+  // Draw Boss Health Bar (Above Boss)
+  float hpPercent = (float)swarm->boss.health / (float)swarm->boss.maxHealth;
+
+  SDL_SetRenderDrawColor(ctx->renderer, 255, 0, 0, 255); // Red Background
+  SDL_FRect hpBg = {x, y - 15, width, 10};
+  SDL_RenderFillRect(ctx->renderer, &hpBg);
+
+  SDL_SetRenderDrawColor(ctx->renderer, 0, 255, 0, 255); // Green Foreground
+  SDL_FRect hpFg = {x, y - 15, width * hpPercent, 10};
+  SDL_RenderFillRect(ctx->renderer, &hpFg);
+}
+
+/** @brief How each SwarmKind is drawn. */
+static void (*const drawSwarmKinds[SWARM_KIND_COUNT])(SDL_Context *,
+                                                      const Swarm *) = {
+    [SWARM_GRID] = drawGrid,
+    [SWARM_BOSS] = drawBoss,
+};
+
 void renderSDL(SDL_Context *ctx, const Player *player,
                const Projectiles *projectiles, const Swarm *swarm,
                const ExplosionManager *explosions, const BunkerManager *bunkers,
@@ -301,6 +451,8 @@ void renderSDL(SDL_Context *ctx, const Player *player,
       gameState == STATE_GAME_OVER) {
 
     // A. Player Exhaust (Engine Particle)
+    float playerX = fixedToFloat(player->x);
+    float playerY = fixedToFloat(player->y);
     if (player->health > 0) {
       int frame = player->animFrame;
       if (ctx->exhaustTexture[frame]) {
@@ -309,8 +461,8 @@ void renderSDL(SDL_Context *ctx, const Player *player,
 
         // Position fire below the ship
         SDL_FRect fireRect = {
-            player->x + (player->width / 2.0f) - (fireWidth / 2.0f),
-            player->y + player->height - 5.0f, fireWidth, fireHeight};
+            playerX + (player->width / 2.0f) - (fireWidth / 2.0f),
+            playerY + player->height - 5.0f, fireWidth, fireHeight};
 
         SDL_RenderTexture(ctx->renderer, ctx->exhaustTexture[frame], NULL,
                           &fireRect);
@@ -319,31 +471,29 @@ void renderSDL(SDL_Context *ctx, const Player *player,
 
     // B. Player Sprite
     if (ctx->playerTexture) {
-      SDL_FRect playerRect = {player->x, player->y, (float)player->width,
+      SDL_FRect playerRect = {playerX, playerY, (float)player->width,
                               (float)player->height};
       SDL_RenderTexture(ctx->renderer, ctx->playerTexture, NULL, &playerRect);
     }
 
     // C. Projectiles
     if (projectiles) {
-      for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (projectiles->projectiles[i].active) {
-          SDL_FRect bulletRect = {
-              projectiles->projectiles[i].x, projectiles->projectiles[i].y,
-              projectiles->projectiles[i].w, projectiles->projectiles[i].h};
-
-          // Choose texture based on velocity (Up=Player, Down=Enemy)
-          SDL_Texture *bTex = (projectiles->projectiles[i].velocityY < 0)
-                                  ? ctx->playerProjectileTexture
-                                  : ctx->enemyProjectileTexture;
-
-          if (bTex) {
-            SDL_RenderTexture(ctx->renderer, bTex, NULL, &bulletRect);
-          } else {
-            SDL_SetRenderDrawColor(ctx->renderer, 255, 255, 0,
-                                   255); // Fallback Yellow
-            SDL_RenderFillRect(ctx->renderer, &bulletRect);
-          }
+      for (unsigned i = 0; i < projectiles->count; i++) {
+        SDL_FRect bulletRect = {fixedToFloat(projectiles->x[i]),
+                                fixedToFloat(projectiles->y[i]),
+                                PROJECTILE_WIDTH, PROJECTILE_HEIGHT};
+
+        // Choose texture based on velocity (Up=Player, Down=Enemy)
+        SDL_Texture *bTex = (projectiles->velocityY[i] < 0)
+                                ? ctx->playerProjectileTexture
+                                : ctx->enemyProjectileTexture;
+
+        if (bTex) {
+          SDL_RenderTexture(ctx->renderer, bTex, NULL, &bulletRect);
+        } else {
+          SDL_SetRenderDrawColor(ctx->renderer, 255, 255, 0,
+                                 255); // Fallback Yellow
+          SDL_RenderFillRect(ctx->renderer, &bulletRect);
         }
       }
     }
@@ -351,80 +501,46 @@ void renderSDL(SDL_Context *ctx, const Player *player,
     // D. Bunkers (Shields)
     if (bunkers) {
       for (int b = 0; b < BUNKER_COUNT; b++) {
-        int totalBlocks = BUNKER_ROWS * BUNKER_COLS;
-        for (int i = 0; i < totalBlocks; i++) {
-          // Only draw active blocks
-          if (bunkers->bunkers[b].blocks[i].active) {
-            SDL_FRect blockRect = {bunkers->bunkers[b].blocks[i].x,
-                                   bunkers->bunkers[b].blocks[i].y, BLOCK_SIZE,
-                                   BLOCK_SIZE};
-
-            if (ctx->bunkerTexture) {
-              SDL_RenderTexture(ctx->renderer, ctx->bunkerTexture, NULL,
-                                &blockRect);
-            } else {
-              SDL_SetRenderDrawColor(ctx->renderer, 0, 255, 0,
-                                     255); // Fallback Green
-              SDL_RenderFillRect(ctx->renderer, &blockRect);
-            }
-          }
-        }
-      }
-    }
-
-    // E. Enemies / Boss
-    if (swarm) {
-
-      // --- BOSS MODE (Level 2) ---
-      if (swarm->level == 2 && swarm->boss.active) {
-        SDL_FRect bossRect = {swarm->boss.x, swarm->boss.y, swarm->boss.width,
-                              swarm->boss.height};
-
-        if (ctx->bossTexture) {
-          SDL_RenderTexture(ctx->renderer, ctx->bossTexture, NULL, &bossRect);
-        } else {
-          SDL_SetRenderDrawColor(ctx->renderer, 255, 0, 0, 255);
-          SDL_RenderFillRect(ctx->renderer, &bossRect);
+        const Bunker *bunker = &bunkers->bunkers[b];
+        float bunkerX = fixedToFloat(bunker->x);
+        float bunkerY = fixedToFloat(bunker->y);
+        SDL_FRect bunkerRect = {bunkerX, bunkerY, BUNKER_PIXEL_WIDTH,
+                                BUNKER_PIXEL_HEIGHT};
+
+        // One draw call per bunker, uploading only the fresh craters
+        if (ctx->bunkerTextures[b]) {
+          updateBunkerTexture(ctx, b, bunker);
+          SDL_RenderTexture(ctx->renderer, ctx->bunkerTextures[b], NULL,
+                            &bunkerRect);
+          continue;
         }
 
-        // Draw Boss Health Bar (Above Boss)
-        float hpPercent =
-            (float)swarm->boss.health / (float)swarm->boss.maxHealth;
-
-        SDL_SetRenderDrawColor(ctx->renderer, 255, 0, 0, 255); // Red Background
-        SDL_FRect hpBg = {swarm->boss.x, swarm->boss.y - 15, swarm->boss.width,
-                          10};
-        SDL_RenderFillRect(ctx->renderer, &hpBg);
-
-        SDL_SetRenderDrawColor(ctx->renderer, 0, 255, 0,
-                               255); // Green Foreground
-        SDL_FRect hpFg = {swarm->boss.x, swarm->boss.y - 15,
-                          swarm->boss.width * hpPercent, 10};
-        SDL_RenderFillRect(ctx->renderer, &hpFg);
-      }
-      // --- SWARM MODE (Level 1) ---
-      else {
-        // Toggle texture for animation effect
-        SDL_Texture *currentAlien =
-            swarm->animationFrame ? ctx->enemyTexture2 : ctx->enemyTexture1;
-
-        for (int i = 0; i < TOTAL_ENEMIES; i++) {
-          if (swarm->enemies[i].active) {
-            SDL_FRect enemyRect = {swarm->enemies[i].x, swarm->enemies[i].y,
-                                   (float)swarm->enemies[i].width,
-                                   (float)swarm->enemies[i].height};
-
-            if (currentAlien) {
-              SDL_RenderTexture(ctx->renderer, currentAlien, NULL, &enemyRect);
-            } else {
-              SDL_SetRenderDrawColor(ctx->renderer, 255, 0, 0, 255);
-              SDL_RenderFillRect(ctx->renderer, &enemyRect);
+        // No texture: one rectangle per run of intact pixels
+        SDL_SetRenderDrawColor(ctx->renderer, 0, 255, 0, 255); // Green
+        for (int py = 0; py < BUNKER_PIXEL_HEIGHT; py++) {
+          int px = 0;
+          while (px < BUNKER_PIXEL_WIDTH) {
+            if (!isBunkerPixelSet(bunker, px, py)) {
+              px++;
+              continue;
             }
+            int end = px + 1;
+            while (end < BUNKER_PIXEL_WIDTH &&
+                   isBunkerPixelSet(bunker, end, py))
+              end++;
+            SDL_FRect run = {bunkerX + px, bunkerY + py, (float)(end - px),
+                             1.0f};
+            SDL_RenderFillRect(ctx->renderer, &run);
+            px = end;
           }
         }
       }
     }
 
+    // E. Enemies / Boss
+    if (swarm)
+      drawSwarmKinds[swarm->kind](ctx, swarm);
+
     // F. Explosions
     if (explosions) {
       for (int i = 0; i < MAX_EXPLOSIONS; i++) {
@@ -432,9 +548,9 @@ void renderSDL(SDL_Context *ctx, const Player *player,
           int frame = explosions->explosions[i].currentFrame;
           // Ensure frame index is valid
           if (frame >= 0 && frame < 3 && ctx->explosionTextures[frame]) {
-            SDL_FRect explRect = {explosions->explosions[i].x,
-                                  explosions->explosions[i].y, EXPLOSION_SIZE,
-                                  EXPLOSION_SIZE};
+            SDL_FRect explRect = {fixedToFloat(explosions->explosions[i].x),
+                                  fixedToFloat(explosions->explosions[i].y),
+                                  EXPLOSION_SIZE, EXPLOSION_SIZE};
             SDL_RenderTexture(ctx->renderer, ctx->explosionTextures[frame],
                               NULL, &explRect);
           }
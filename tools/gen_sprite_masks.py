@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Generates src/model/sprite_masks.c and src/model/hit_mask_data.c from
+assets/*.png.
+
+Every sprite is box-filtered down to SPRITE_MASK_SIZE x SPRITE_MASK_SIZE
+alpha coverage (0 = transparent, 255 = opaque), the way SDL stretches the
+whole texture over the entity rectangle. The hit masks are box-filtered
+straight from the full-size alpha to the size of their entity, and keep
+the pixels that are at least half opaque. Only the standard library is
+used (the assets are 8-bit RGBA, non-interlaced PNGs).
+
+Usage: python3 tools/gen_sprite_masks.py   (from the repository root)
+"""
+import struct
+import zlib
+
+SIZE = 32  # Must match SPRITE_MASK_SIZE in includes/sprite_masks.h
+OPAQUE = 128  # Must match RASTER_OPAQUE in src/model/raster.c
+
+# (enum name, asset) in SpriteId order
+SPRITES = [
+    ("SPRITE_PLAYER", "player.png"),
+    ("SPRITE_ALIEN_1", "alien_1.png"),
+    ("SPRITE_ALIEN_2", "alien_2.png"),
+    ("SPRITE_BOSS", "boss.png"),
+    ("SPRITE_BULLET_PLAYER", "bullet_1.png"),
+    ("SPRITE_BULLET_ENEMY", "bullet_2.png"),
+    ("SPRITE_BUNKER", "bunker.png"),
+    ("SPRITE_EXPLOSION_1", "explosion_1.png"),
+    ("SPRITE_EXPLOSION_2", "explosion_2.png"),
+    ("SPRITE_EXPLOSION_3", "explosion_3.png"),
+]
+
+
+def read_alpha(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    assert data[:8] == b"\x89PNG\r\n\x1a\n", path
+    pos, idat = 8, b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(
+                ">IIBBBBB", body)
+            assert depth == 8 and color == 6 and interlace == 0, path
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    raw = zlib.decompress(idat)
+    stride = width * 4
+    prev = bytearray(stride)
+    alpha = []
+    for y in range(height):
+        base = y * (stride + 1)
+        kind = raw[base]
+        line = bytearray(raw[base + 1:base + 1 + stride])
+        for i in range(stride):
+            a = line[i - 4] if i >= 4 else 0
+            b = prev[i]
+            c = prev[i - 4] if i >= 4 else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        alpha.append(line[3::4])
+        prev = line
+    return width, height, alpha
+
+# (HitMaskId name, asset, width, height, size constants) in HitMaskId order
+HIT_MASKS = [
+    ("HIT_MASK_ALIEN_1", "alien_1.png", 40, 30, ("ENEMY_WIDTH",
+                                                 "ENEMY_HEIGHT")),
+    ("HIT_MASK_ALIEN_2", "alien_2.png", 40, 30, ("ENEMY_WIDTH",
+                                                 "ENEMY_HEIGHT")),
+    ("HIT_MASK_BOSS", "boss.png", 64, 64, ("BOSS_WIDTH", "BOSS_HEIGHT")),
+]
+
+
+def downsample(width, height, alpha, size_x=SIZE, size_y=SIZE):
+    mask = []
+    for my in range(size_y):
+        y0, y1 = my * height // size_y, max((my + 1) * height // size_y,
+                                            my * height // size_y + 1)
+        for mx in range(size_x):
+            x0, x1 = mx * width // size_x, max((mx + 1) * width // size_x,
+                                               mx * width // size_x + 1)
+            total = sum(sum(alpha[y][x0:x1]) for y in range(y0, y1))
+            mask.append(total // ((y1 - y0) * (x1 - x0)))
+    return mask
+
+
+def hit_mask_columns(width, height, alpha, mask_width, mask_height):
+    """One word per column, bit y set if pixel (x, y) is opaque."""
+    coverage = downsample(width, height, alpha, mask_width, mask_height)
+    columns = []
+    for x in range(mask_width):
+        word = 0
+        for y in range(mask_height):
+            if coverage[y * mask_width + x] >= OPAQUE:
+                word |= 1 << y
+        columns.append(word)
+    return columns
+
+
+def write_hit_masks(alphas):
+    out = ["// Generated by tools/gen_sprite_masks.py from assets/*.png.",
+           "// Do not edit by hand.", "",
+           '#include "../../includes/enemy.h"',
+           '#include "../../includes/hit_mask.h"', ""]
+    sizes = []
+    for _, _, width, height, names in HIT_MASKS:
+        if (names, width, height) not in sizes:
+            sizes.append((names, width, height))
+    for (width_name, height_name), width, height in sizes:
+        out.append("_Static_assert(%s == %d && %s == %d," %
+                   (width_name, width, height_name, height))
+        out.append('               "rerun tools/gen_sprite_masks.py");')
+    out += ["", "const HitMask hitMaskData[HIT_MASK_COUNT] = {"]
+    for name, asset, width, height, _ in HIT_MASKS:
+        columns = hit_mask_columns(*alphas[asset], width, height)
+        out.append("    [%s] =" % name)
+        out.append("        {%d," % width)
+        out.append("         %d," % height)
+        out.append("         {")
+        for start in range(0, width, 2):
+            chunk = columns[start:start + 2]
+            out.append("             " +
+                       ", ".join("0x%016xull" % c for c in chunk) + ",")
+        out.append("         }},")
+    out.append("};")
+    with open("src/model/hit_mask_data.c", "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def main():
+    out = ["// Generated by tools/gen_sprite_masks.py from assets/*.png.",
+           "// Do not edit by hand.", "",
+           '#include "../../includes/sprite_masks.h"', "",
+           "const uint8_t spriteMasks[SPRITE_COUNT][SPRITE_MASK_SIZE *",
+           "                                        SPRITE_MASK_SIZE] = {"]
+    alphas = {asset: read_alpha("assets/" + asset) for _, asset in SPRITES}
+    for name, asset in SPRITES:
+        mask = downsample(*alphas[asset])
+        out.append("    [%s] =" % name)
+        out.append("        {")
+        for row in range(SIZE):
+            values = mask[row * SIZE:(row + 1) * SIZE]
+            for start in range(0, SIZE, 12):
+                chunk = values[start:start + 12]
+                out.append("            " +
+                           ", ".join("%d" % v for v in chunk) + ",")
+        out.append("        },")
+    out.append("};")
+    with open("src/model/sprite_masks.c", "w") as f:
+        f.write("\n".join(out) + "\n")
+    write_hit_masks(alphas)
+
+
+if __name__ == "__main__":
+    main()